@@ -1 +1,72 @@
-export default process._linkedBinding('electron_browser_content_tracing');
+import * as path from 'path';
+import { app, webContents } from 'electron/main';
+
+const binding = process._linkedBinding('electron_browser_content_tracing');
+
+const defaultFlightRecorderCategories = ['toplevel', 'electron', 'ipc', 'v8'];
+
+let unresponsiveDumpPath: string | null = null;
+let unresponsiveDumpCount = 0;
+
+// Each dump gets its own file next to |unresponsiveDumpPath|, so that dumps
+// never overwrite each other.
+const getUnresponsiveDumpPath = (dumpPath: string) => {
+  const { dir, name, ext } = path.parse(dumpPath);
+  const suffix = `${Date.now()}-${++unresponsiveDumpCount}`;
+  return path.join(dir, `${name}-${suffix}${ext}`);
+};
+
+const dumpOnUnresponsive = () => {
+  if (unresponsiveDumpPath) {
+    // Rejected while another dump is being written, which already covers it.
+    binding.dumpFlightRecording(getUnresponsiveDumpPath(unresponsiveDumpPath)).catch(() => {});
+  }
+};
+
+const onWebContentsCreated = (event: Electron.Event, contents: Electron.WebContents) => {
+  contents.on('unresponsive', dumpOnUnresponsive);
+};
+
+// The handlers are only attached while a flight recording with an
+// |unresponsiveDumpPath| is running.
+const installUnresponsiveHandler = () => {
+  if (unresponsiveDumpPath) return;
+  for (const contents of webContents.getAllWebContents()) {
+    contents.on('unresponsive', dumpOnUnresponsive);
+  }
+  app.on('web-contents-created', onWebContentsCreated);
+};
+
+const removeUnresponsiveHandler = () => {
+  if (!unresponsiveDumpPath) return;
+  unresponsiveDumpPath = null;
+  for (const contents of webContents.getAllWebContents()) {
+    contents.removeListener('unresponsive', dumpOnUnresponsive);
+  }
+  app.removeListener('web-contents-created', onWebContentsCreated);
+};
+
+const startFlightRecording = async (options: Electron.FlightRecorderOptions = {}): Promise<void> => {
+  const { categories = defaultFlightRecorderCategories, bufferSize, unresponsiveDumpPath: dumpPath } = options;
+  await binding.startFlightRecording({ categories, bufferSize });
+  if (dumpPath) {
+    installUnresponsiveHandler();
+    unresponsiveDumpPath = dumpPath;
+  } else {
+    removeUnresponsiveHandler();
+  }
+};
+
+const stopRecording = (resultFilePath?: string): Promise<string> => {
+  removeUnresponsiveHandler();
+  return binding.stopRecording(resultFilePath);
+};
+
+export default {
+  getCategories: binding.getCategories,
+  startRecording: binding.startRecording,
+  stopRecording,
+  getTraceBufferUsage: binding.getTraceBufferUsage,
+  startFlightRecording,
+  dumpFlightRecording: binding.dumpFlightRecording
+};
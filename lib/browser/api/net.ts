@@ -11,6 +11,7 @@ const {
 } = process._linkedBinding('electron_browser_net');
 
 const kSupportedProtocols = new Set(['http:', 'https:']);
+const kRequestPriorities = new Set(['throttled', 'idle', 'lowest', 'low', 'medium', 'highest']);
 
 // set of headers that Node.js discards duplicates for
 // see https://nodejs.org/api/http.html#http_message_headers
@@ -57,6 +58,14 @@ class IncomingMessage extends Readable {
     return this._responseHead.statusMessage;
   }
 
+  get connectionInfo () {
+    return this._responseHead.connectionInfo;
+  }
+
+  get socketReused () {
+    return this._responseHead.socketReused;
+  }
+
   get headers () {
     const filteredHeaders: Record<string, string | string[]> = {};
     const { rawHeaders } = this._responseHead;
@@ -267,6 +276,10 @@ function parseOptions (optionsIn: ClientRequestConstructorOptions | string): Nod
     throw new TypeError('headers must be an object');
   }
 
+  if (options.priority !== undefined && !kRequestPriorities.has(options.priority)) {
+    throw new Error('priority should be one of throttled, idle, lowest, low, medium or highest');
+  }
+
   const urlLoaderOptions: NodeJS.CreateURLLoaderOptions & { redirectPolicy: RedirectPolicy, headers: Record<string, { name: string, value: string | string[] }> } = {
     method: (options.method || 'GET').toUpperCase(),
     url: urlStr,
@@ -275,7 +288,8 @@ function parseOptions (optionsIn: ClientRequestConstructorOptions | string): Nod
     body: null as any,
     useSessionCookies: options.useSessionCookies,
     credentials: options.credentials,
-    origin: options.origin
+    origin: options.origin,
+    priority: options.priority
   };
   const headers: Record<string, string | string[]> = options.headers || {};
   for (const [name, value] of Object.entries(headers)) {
@@ -319,16 +319,23 @@ WebContents.prototype.printToPDF = async function (options) {
     printSettings.mediaSize = PDFPageSizes.A4;
   }
 
+  if (options.path !== undefined) {
+    if (typeof options.path !== 'string') {
+      const error = new Error('path must be a String');
+      return Promise.reject(error);
+    }
+    printSettings.outputPath = options.path;
+  }
+
   // Chromium expects this in a 0-100 range number, not as float
   printSettings.scaleFactor = Math.ceil(printSettings.scaleFactor) % 100;
   // PrinterType enum from //printing/print_job_constants.h
   printSettings.printerType = 2;
   if (this._printToPDF) {
-    if (pendingPromise) {
-      pendingPromise = pendingPromise.then(() => this._printToPDF(printSettings));
-    } else {
-      pendingPromise = this._printToPDF(printSettings);
-    }
+    // Requests are handled one at a time, a rejected one does not block the
+    // ones queued after it.
+    const print = () => this._printToPDF(printSettings);
+    pendingPromise = pendingPromise ? pendingPromise.then(print, print) : print();
     return pendingPromise;
   } else {
     const error = new Error('Printing feature is disabled');
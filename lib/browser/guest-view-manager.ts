@@ -347,6 +347,11 @@ handleMessage(IPC_MESSAGES.GUEST_VIEW_MANAGER_CALL, function (event, guestInstan
     throw new Error(`Invalid method: ${method}`);
   }
 
+  // Renderers must not choose the file the main process writes the PDF to.
+  if (method === 'printToPDF' && args[0] && typeof args[0] === 'object') {
+    args[0] = { ...args[0], path: undefined };
+  }
+
   return (guest as any)[method](...args);
 });
 
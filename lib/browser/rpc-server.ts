@@ -41,12 +41,36 @@ ipcMainUtils.handleSync(IPC_MESSAGES.BROWSER_CLIPBOARD_SYNC, function (event, me
   return (clipboard as any)[method](...args);
 });
 
+// Preload scripts are requested by every sandboxed renderer while it is
+// blocked on a sync IPC, so keep their contents around and only read them
+// again when the file has changed on disk. The cache is a small LRU keyed on
+// the path, relying on Map keeping keys in insertion order.
+const kPreloadScriptCacheSize = 16;
+const preloadScriptCache = new Map<string, { mtimeMs: number, size: number, preloadSrc: string }>();
+
+const readPreloadScript = async function (preloadPath: string) {
+  const { mtimeMs, size } = await fs.promises.stat(preloadPath);
+  const cached = preloadScriptCache.get(preloadPath);
+  preloadScriptCache.delete(preloadPath);
+  if (cached && cached.mtimeMs === mtimeMs && cached.size === size) {
+    preloadScriptCache.set(preloadPath, cached);
+    return cached.preloadSrc;
+  }
+  const preloadSrc = await fs.promises.readFile(preloadPath, 'utf8');
+  preloadScriptCache.set(preloadPath, { mtimeMs, size, preloadSrc });
+  if (preloadScriptCache.size > kPreloadScriptCacheSize) {
+    preloadScriptCache.delete(preloadScriptCache.keys().next().value);
+  }
+  return preloadSrc;
+};
+
 const getPreloadScript = async function (preloadPath: string) {
   let preloadSrc = null;
   let preloadError = null;
   try {
-    preloadSrc = await fs.promises.readFile(preloadPath, 'utf8');
+    preloadSrc = await readPreloadScript(preloadPath);
   } catch (error) {
+    preloadScriptCache.delete(preloadPath);
     preloadError = error;
   }
   return { preloadPath, preloadSrc, preloadError };
@@ -17,6 +17,8 @@
 #include "base/files/file_util.h"
 #include "base/path_service.h"
 #include "base/system/sys_info.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/thread_restrictions.h"
 #include "base/values.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/icon_manager.h"
@@ -640,6 +642,16 @@ void OnIconDataAvailable(gin_helper::Promise<gfx::Image> promise,
   }
 }
 
+#if BUILDFLAG(IS_LINUX)
+std::map<base::ProcessId, ProcessMemoryInfo> ReadDetailedMemoryInfo(
+    const std::vector<base::ProcessId>& pids) {
+  std::map<base::ProcessId, ProcessMemoryInfo> result;
+  for (base::ProcessId pid : pids)
+    result[pid] = ProcessMetric::ReadMemoryInfo(pid, true /* detailed */);
+  return result;
+}
+#endif
+
 }  // namespace
 
 App::App() {
@@ -955,6 +967,33 @@ void App::ChildProcessDisconnected(int pid) {
   app_metrics_.erase(pid);
 }
 
+App::MemoryInfoMap App::ReadMemoryInfoSync() const {
+  MemoryInfoMap result;
+#if BUILDFLAG(IS_LINUX)
+  // Only status is read here, like getAppMetrics always did; the detailed
+  // metrics are read off the UI thread by sampleAppMetrics.
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+#endif
+  for (const auto& process_metric : app_metrics_) {
+    base::ProcessId pid = process_metric.second->process.Pid();
+#if BUILDFLAG(IS_LINUX)
+    result[pid] = ProcessMetric::ReadMemoryInfo(pid, false /* detailed */);
+#else
+    result[pid] = process_metric.second->GetMemoryInfo();
+#endif
+  }
+  return result;
+}
+
+void App::OnAppMetricsSampled(
+    gin_helper::Promise<std::vector<gin_helper::Dictionary>> promise,
+    MemoryInfoMap memory_info) {
+  v8::Isolate* isolate = promise.isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  promise.Resolve(BuildAppMetrics(isolate, memory_info, true /* detailed */));
+}
+
 base::FilePath App::GetAppPath() const {
   return app_path_;
 }
@@ -1404,11 +1443,48 @@ v8::Local<v8::Promise> App::GetFileIcon(const base::FilePath& path,
 }
 
 std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
+  return BuildAppMetrics(isolate, ReadMemoryInfoSync(), false /* detailed */);
+}
+
+v8::Local<v8::Promise> App::SampleAppMetrics(v8::Isolate* isolate) {
+  gin_helper::Promise<std::vector<gin_helper::Dictionary>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+#if BUILDFLAG(IS_LINUX)
+  // Reading procfs blocks, so all processes are read in one batch off the UI
+  // thread.
+  std::vector<base::ProcessId> pids;
+  pids.reserve(app_metrics_.size());
+  for (const auto& process_metric : app_metrics_)
+    pids.push_back(process_metric.second->process.Pid());
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ReadDetailedMemoryInfo, std::move(pids)),
+      base::BindOnce(&App::OnAppMetricsSampled, weak_factory_.GetWeakPtr(),
+                     std::move(promise)));
+#else
+  promise.Resolve(
+      BuildAppMetrics(isolate, ReadMemoryInfoSync(), true /* detailed */));
+#endif
+  return handle;
+}
+
+std::vector<gin_helper::Dictionary> App::BuildAppMetrics(
+    v8::Isolate* isolate,
+    const MemoryInfoMap& memory_info,
+    bool detailed) {
   std::vector<gin_helper::Dictionary> result;
   result.reserve(app_metrics_.size());
   int processor_count = base::SysInfo::NumberOfProcessors();
 
   for (const auto& process_metric : app_metrics_) {
+    // Processes launched after the memory info was read are left out, so
+    // every entry is complete.
+    auto it = memory_info.find(process_metric.second->process.Pid());
+    if (it == memory_info.end())
+      continue;
+
     gin_helper::Dictionary pid_dict = gin::Dictionary::CreateEmpty(isolate);
     gin_helper::Dictionary cpu_dict = gin::Dictionary::CreateEmpty(isolate);
 
@@ -1444,24 +1520,36 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
       pid_dict.Set("name", process_metric.second->name);
     }
 
-#if !BUILDFLAG(IS_LINUX)
-    auto memory_info = process_metric.second->GetMemoryInfo();
-
+    const ProcessMemoryInfo& process_memory_info = it->second;
     gin_helper::Dictionary memory_dict = gin::Dictionary::CreateEmpty(isolate);
     memory_dict.SetHidden("simple", true);
-    memory_dict.Set("workingSetSize",
-                    static_cast<double>(memory_info.working_set_size >> 10));
+    memory_dict.Set(
+        "workingSetSize",
+        static_cast<double>(process_memory_info.working_set_size >> 10));
     memory_dict.Set(
         "peakWorkingSetSize",
-        static_cast<double>(memory_info.peak_working_set_size >> 10));
+        static_cast<double>(process_memory_info.peak_working_set_size >> 10));
 
 #if BUILDFLAG(IS_WIN)
-    memory_dict.Set("privateBytes",
-                    static_cast<double>(memory_info.private_bytes >> 10));
+    memory_dict.Set(
+        "privateBytes",
+        static_cast<double>(process_memory_info.private_bytes >> 10));
+#elif BUILDFLAG(IS_LINUX)
+    // procfs is only read in detail off the UI thread.
+    if (detailed) {
+      memory_dict.Set(
+          "privateBytes",
+          static_cast<double>(process_memory_info.private_bytes >> 10));
+      memory_dict.Set(
+          "sharedBytes",
+          static_cast<double>(process_memory_info.shared_bytes >> 10));
+      memory_dict.Set(
+          "swapBytes",
+          static_cast<double>(process_memory_info.swap_bytes >> 10));
+    }
 #endif
 
     pid_dict.Set("memory", memory_dict);
-#endif
 
 #if BUILDFLAG(IS_MAC)
     pid_dict.Set("sandboxed", process_metric.second->IsSandboxed());
@@ -1478,6 +1566,26 @@ std::vector<gin_helper::Dictionary> App::GetAppMetrics(v8::Isolate* isolate) {
   return result;
 }
 
+v8::Local<v8::Value> App::GetStartupTimings(v8::Isolate* isolate) {
+  const auto& timings = ElectronBrowserMainParts::Get()->startup_timings();
+  // Phases are reported in ms since the bootstrap started, 0 if unfinished.
+  auto since_bootstrap = [&timings](base::TimeTicks phase) {
+    if (phase.is_null())
+      return 0.0;
+    return (phase - timings.bootstrap_started).InMillisecondsF();
+  };
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  dict.SetHidden("simple", true);
+  dict.Set("bootstrapStarted", timings.bootstrap_started_time.ToJsTime());
+  dict.Set("jsEnvironmentCreated",
+           since_bootstrap(timings.js_environment_created));
+  dict.Set("nodeEnvironmentCreated",
+           since_bootstrap(timings.node_environment_created));
+  dict.Set("nodeEnvironmentLoaded",
+           since_bootstrap(timings.node_environment_loaded));
+  return dict.GetHandle();
+}
+
 v8::Local<v8::Value> App::GetGPUFeatureStatus(v8::Isolate* isolate) {
   return gin::ConvertToV8(isolate, content::GetFeatureStatus());
 }
@@ -1837,6 +1945,8 @@ gin::ObjectTemplateBuilder App::GetObjectTemplateBuilder(v8::Isolate* isolate) {
                  &App::DisableDomainBlockingFor3DAPIs)
       .SetMethod("getFileIcon", &App::GetFileIcon)
       .SetMethod("getAppMetrics", &App::GetAppMetrics)
+      .SetMethod("sampleAppMetrics", &App::SampleAppMetrics)
+      .SetMethod("getStartupTimings", &App::GetStartupTimings)
       .SetMethod("getGPUFeatureStatus", &App::GetGPUFeatureStatus)
       .SetMethod("getGPUInfo", &App::GetGPUInfo)
 #if defined(MAS_BUILD)
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/weak_ptr.h"
 #include "base/task/cancelable_task_tracker.h"
 #include "chrome/browser/icon_manager.h"
 #include "chrome/browser/process_singleton.h"
@@ -179,6 +180,19 @@ class App : public ElectronBrowserClient::Delegate,
                             const std::string& service_name = std::string(),
                             const std::string& name = std::string());
   void ChildProcessDisconnected(int pid);
+  // Memory info of processes keyed by pid.
+  using MemoryInfoMap = std::map<base::ProcessId, ProcessMemoryInfo>;
+  // Builds the ProcessMetric objects of the processes in |app_metrics_|,
+  // skipping those missing from |memory_info|. On Linux |detailed| adds the
+  // memory metrics that are only read off the UI thread.
+  std::vector<gin_helper::Dictionary> BuildAppMetrics(
+      v8::Isolate* isolate,
+      const MemoryInfoMap& memory_info,
+      bool detailed);
+  MemoryInfoMap ReadMemoryInfoSync() const;
+  void OnAppMetricsSampled(
+      gin_helper::Promise<std::vector<gin_helper::Dictionary>> promise,
+      MemoryInfoMap memory_info);
 
   void SetAppLogsPath(gin_helper::ErrorThrower thrower,
                       absl::optional<base::FilePath> custom_path);
@@ -218,6 +232,8 @@ class App : public ElectronBrowserClient::Delegate,
                                      gin::Arguments* args);
 
   std::vector<gin_helper::Dictionary> GetAppMetrics(v8::Isolate* isolate);
+  v8::Local<v8::Promise> SampleAppMetrics(v8::Isolate* isolate);
+  v8::Local<v8::Value> GetStartupTimings(v8::Isolate* isolate);
   v8::Local<v8::Value> GetGPUFeatureStatus(v8::Isolate* isolate);
   v8::Local<v8::Promise> GetGPUInfo(v8::Isolate* isolate,
                                     const std::string& info_type);
@@ -269,6 +285,8 @@ class App : public ElectronBrowserClient::Delegate,
 
   bool disable_hw_acceleration_ = false;
   bool disable_domain_blocking_for_3DAPIs_ = false;
+
+  base::WeakPtrFactory<App> weak_factory_{this};
 };
 
 }  // namespace api
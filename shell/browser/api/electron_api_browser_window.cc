@@ -5,6 +5,7 @@
 #include "shell/browser/api/electron_api_browser_window.h"
 
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/trace_event/trace_event.h"
 #include "content/browser/renderer_host/render_widget_host_impl.h"  // nogncheck
 #include "content/browser/renderer_host/render_widget_host_owner_delegate.h"  // nogncheck
 #include "content/browser/web_contents/web_contents_impl.h"  // nogncheck
@@ -498,6 +499,7 @@ void BrowserWindow::OnWindowHide() {
 // static
 gin_helper::WrappableBase* BrowserWindow::New(gin_helper::ErrorThrower thrower,
                                               gin::Arguments* args) {
+  TRACE_EVENT0("electron", "BrowserWindow::New");
   if (!Browser::Get()->is_ready()) {
     thrower.ThrowError("Cannot create BrowserWindow before app is ready");
     return nullptr;
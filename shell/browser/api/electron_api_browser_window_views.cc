@@ -23,12 +23,10 @@ void BrowserWindow::UpdateDraggableRegions(
     if (view) {
       const gfx::NativeView nv = view->GetNativeView();
       auto const offset = nv->GetBoundsInRootWindow();
-      auto snapped_regions = mojo::Clone(regions);
-      for (auto& snapped_region : snapped_regions) {
+      draggable_regions_ = mojo::Clone(regions);
+      for (auto& snapped_region : draggable_regions_) {
         snapped_region->bounds.Offset(offset.x(), offset.y());
       }
-
-      draggable_regions_ = mojo::Clone(snapped_regions);
     }
   }
 
@@ -5,8 +5,12 @@
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "base/callback_helpers.h"
 #include "base/files/file_util.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_util.h"
 #include "base/task/thread_pool.h"
 #include "base/threading/thread_restrictions.h"
 #include "base/trace_event/trace_config.h"
@@ -58,6 +62,19 @@ namespace {
 
 using CompletionCallback = base::OnceCallback<void(const base::FilePath&)>;
 
+// Ring buffer size of the flight recorder when none is given, in KB.
+constexpr uint32_t kDefaultFlightRecorderBufferSizeKb = 8 * 1024;
+
+// The config of the flight recording in progress, if any.
+absl::optional<base::trace_event::TraceConfig>& FlightRecordingConfig() {
+  static base::NoDestructor<absl::optional<base::trace_event::TraceConfig>>
+      config;
+  return *config;
+}
+
+// Whether a dump of the flight recording is being written.
+bool g_dumping_flight_recording = false;
+
 absl::optional<base::FilePath> CreateTemporaryFileOnIO() {
   base::FilePath temp_file_path;
   if (!base::CreateTemporaryFile(&temp_file_path))
@@ -95,6 +112,8 @@ void StopTracing(gin_helper::Promise<base::FilePath> promise,
 }
 
 v8::Local<v8::Promise> StopRecording(gin_helper::Arguments* args) {
+  FlightRecordingConfig().reset();
+
   gin_helper::Promise<base::FilePath> promise(args->isolate());
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
@@ -143,6 +162,117 @@ v8::Local<v8::Promise> StartTracing(
   return handle;
 }
 
+void OnFlightRecordingStarted(
+    gin_helper::Promise<void> promise,
+    const base::trace_event::TraceConfig& trace_config,
+    bool success) {
+  // Only a recording that has started can be dumped, and a failed start must
+  // not leave its config behind for later dumps.
+  if (!success || !TracingController::GetInstance()->IsTracing()) {
+    promise.RejectWithErrorMessage("Failed to start the flight recording");
+    return;
+  }
+
+  FlightRecordingConfig() = trace_config;
+  promise.Resolve();
+}
+
+v8::Local<v8::Promise> StartFlightRecording(v8::Isolate* isolate,
+                                            gin_helper::Dictionary options) {
+  if (FlightRecordingConfig() ||
+      TracingController::GetInstance()->IsTracing()) {
+    gin_helper::Promise<void> promise(isolate);
+    v8::Local<v8::Promise> handle = promise.GetHandle();
+    promise.RejectWithErrorMessage("A trace is already in progress");
+    return handle;
+  }
+
+  std::vector<std::string> categories;
+  options.Get("categories", &categories);
+  uint32_t buffer_size_kb = kDefaultFlightRecorderBufferSizeKb;
+  options.Get("bufferSize", &buffer_size_kb);
+
+  // Record continuously into a bounded ring buffer, so that the recorder can
+  // be left running and only the most recent events are kept.
+  base::trace_event::TraceConfig trace_config(
+      base::JoinString(categories, ","),
+      base::trace_event::RECORD_CONTINUOUSLY);
+  trace_config.SetTraceBufferSizeInKb(buffer_size_kb);
+
+  gin_helper::Promise<void> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  auto split_callback = base::SplitOnceCallback(base::BindOnce(
+      &OnFlightRecordingStarted, std::move(promise), trace_config));
+  if (!TracingController::GetInstance()->StartTracing(
+          trace_config, base::BindOnce(std::move(split_callback.first), true)))
+    std::move(split_callback.second).Run(false);
+  return handle;
+}
+
+void OnFlightRecordingDumped(gin_helper::Promise<base::FilePath> promise,
+                             const base::FilePath& path,
+                             absl::optional<std::string> error) {
+  g_dumping_flight_recording = false;
+
+  // Resume recording unless it was stopped while dumping.
+  if (auto& config = FlightRecordingConfig())
+    TracingController::GetInstance()->StartTracing(*config, base::DoNothing());
+
+  if (error)
+    promise.RejectWithErrorMessage(error.value());
+  else
+    promise.Resolve(path);
+}
+
+void DumpFlightRecordingToFile(gin_helper::Promise<base::FilePath> promise,
+                               absl::optional<base::FilePath> file_path) {
+  if (!file_path) {
+    g_dumping_flight_recording = false;
+    promise.RejectWithErrorMessage(
+        "Failed to create temporary file for trace data");
+    return;
+  }
+
+  auto split_callback = base::SplitOnceCallback(base::BindOnce(
+      &OnFlightRecordingDumped, std::move(promise), *file_path));
+  auto endpoint = TracingController::CreateFileEndpoint(
+      *file_path,
+      base::BindOnce(std::move(split_callback.first), absl::nullopt));
+  if (!TracingController::GetInstance()->StopTracing(endpoint)) {
+    std::move(split_callback.second)
+        .Run(absl::make_optional("Failed to dump the flight recording"));
+  }
+}
+
+v8::Local<v8::Promise> DumpFlightRecording(gin_helper::Arguments* args) {
+  gin_helper::Promise<base::FilePath> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (!FlightRecordingConfig()) {
+    promise.RejectWithErrorMessage("No flight recording in progress");
+    return handle;
+  }
+
+  // Dumping stops and restarts the recording, which can not overlap.
+  if (g_dumping_flight_recording) {
+    promise.RejectWithErrorMessage("A dump is already in progress");
+    return handle;
+  }
+  g_dumping_flight_recording = true;
+
+  base::FilePath path;
+  if (args->GetNext(&path) && !path.empty()) {
+    DumpFlightRecordingToFile(std::move(promise), absl::make_optional(path));
+  } else {
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
+        base::BindOnce(CreateTemporaryFileOnIO),
+        base::BindOnce(DumpFlightRecordingToFile, std::move(promise)));
+  }
+
+  return handle;
+}
+
 void OnTraceBufferUsageAvailable(
     gin_helper::Promise<gin_helper::Dictionary> promise,
     float percent_full,
@@ -172,6 +302,8 @@ void Initialize(v8::Local<v8::Object> exports,
   dict.SetMethod("getCategories", &GetCategories);
   dict.SetMethod("startRecording", &StartTracing);
   dict.SetMethod("stopRecording", &StopRecording);
+  dict.SetMethod("startFlightRecording", &StartFlightRecording);
+  dict.SetMethod("dumpFlightRecording", &DumpFlightRecording);
   dict.SetMethod("getTraceBufferUsage", &GetTraceBufferUsage);
 }
 
@@ -6,6 +6,8 @@
 
 #include <utility>
 
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
 #include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/browser/browser_context.h"
@@ -97,49 +99,68 @@ namespace api {
 
 namespace {
 
-// Returns whether |domain| matches |filter|.
-bool MatchesDomain(std::string filter, const std::string& domain) {
-  // Add a leading '.' character to the filter domain if it doesn't exist.
-  if (net::cookie_util::DomainIsHostOnly(filter))
-    filter.insert(0, ".");
+// The filter passed to cookies.get, parsed once up front so that matching it
+// against a large cookie jar does no per-cookie dictionary lookups or string
+// copies.
+struct CookieFilter {
+  CookieFilter() = default;
+  explicit CookieFilter(const base::Value& filter) {
+    const std::string* str;
+    if ((str = filter.FindStringKey("name")))
+      name = *str;
+    if ((str = filter.FindStringKey("path")))
+      path = *str;
+    if ((str = filter.FindStringKey("domain"))) {
+      // A leading '.' makes no difference for domain matching.
+      base::StringPiece filter_domain(*str);
+      if (!net::cookie_util::DomainIsHostOnly(*str))
+        filter_domain.remove_prefix(1);
+      domain = std::string(filter_domain);
+    }
+    secure = filter.FindBoolKey("secure");
+    session = filter.FindBoolKey("session");
+  }
+
+  absl::optional<std::string> name;
+  absl::optional<std::string> path;
+  absl::optional<std::string> domain;
+  absl::optional<bool> secure;
+  absl::optional<bool> session;
+};
 
-  std::string sub_domain(domain);
+// Returns whether |domain| is |filter| or a subdomain of it, |filter| should
+// not have a leading '.' character.
+bool MatchesDomain(base::StringPiece filter, base::StringPiece domain) {
   // Strip any leading '.' character from the input cookie domain.
-  if (!net::cookie_util::DomainIsHostOnly(sub_domain))
-    sub_domain = sub_domain.substr(1);
-
-  // Now check whether the domain argument is a subdomain of the filter domain.
-  for (sub_domain.insert(0, "."); sub_domain.length() >= filter.length();) {
-    if (sub_domain == filter)
-      return true;
-    const size_t next_dot = sub_domain.find('.', 1);  // Skip over leading dot.
-    sub_domain.erase(0, next_dot);
-  }
-  return false;
+  if (!domain.empty() && domain[0] == '.')
+    domain.remove_prefix(1);
+
+  if (filter.empty())
+    return domain.empty();
+  if (!base::EndsWith(domain, filter))
+    return false;
+  return domain.size() == filter.size() ||
+         domain[domain.size() - filter.size() - 1] == '.';
 }
 
 // Returns whether |cookie| matches |filter|.
-bool MatchesCookie(const base::Value& filter,
+bool MatchesCookie(const CookieFilter& filter,
                    const net::CanonicalCookie& cookie) {
-  const std::string* str;
-  if ((str = filter.FindStringKey("name")) && *str != cookie.Name())
+  if (filter.name && *filter.name != cookie.Name())
     return false;
-  if ((str = filter.FindStringKey("path")) && *str != cookie.Path())
+  if (filter.path && *filter.path != cookie.Path())
     return false;
-  if ((str = filter.FindStringKey("domain")) &&
-      !MatchesDomain(*str, cookie.Domain()))
+  if (filter.domain && !MatchesDomain(*filter.domain, cookie.Domain()))
     return false;
-  absl::optional<bool> secure_filter = filter.FindBoolKey("secure");
-  if (secure_filter && *secure_filter == cookie.IsSecure())
+  if (filter.secure && *filter.secure == cookie.IsSecure())
     return false;
-  absl::optional<bool> session_filter = filter.FindBoolKey("session");
-  if (session_filter && *session_filter != !cookie.IsPersistent())
+  if (filter.session && *filter.session != !cookie.IsPersistent())
     return false;
   return true;
 }
 
 // Remove cookies from |list| not matching |filter|, and pass it to |callback|.
-void FilterCookies(const base::Value& filter,
+void FilterCookies(const CookieFilter& filter,
                    gin_helper::Promise<net::CookieList> promise,
                    const net::CookieList& cookies) {
   net::CookieList result;
@@ -151,7 +172,7 @@ void FilterCookies(const base::Value& filter,
 }
 
 void FilterCookieWithStatuses(
-    const base::Value& filter,
+    const CookieFilter& filter,
     gin_helper::Promise<net::CookieList> promise,
     const net::CookieAccessResultList& list,
     const net::CookieAccessResultList& excluded_list) {
@@ -235,12 +256,14 @@ v8::Local<v8::Promise> Cookies::Get(v8::Isolate* isolate,
 
   base::DictionaryValue dict;
   gin::ConvertFromV8(isolate, filter.GetHandle(), &dict);
+  CookieFilter cookie_filter(dict);
 
   std::string url;
   filter.Get("url", &url);
   if (url.empty()) {
     manager->GetAllCookies(
-        base::BindOnce(&FilterCookies, std::move(dict), std::move(promise)));
+        base::BindOnce(&FilterCookies, std::move(cookie_filter),
+                       std::move(promise)));
   } else {
     net::CookieOptions options;
     options.set_include_httponly();
@@ -251,7 +274,8 @@ v8::Local<v8::Promise> Cookies::Get(v8::Isolate* isolate,
     manager->GetCookieList(GURL(url), options,
                            net::CookiePartitionKeyCollection::Todo(),
                            base::BindOnce(&FilterCookieWithStatuses,
-                                          std::move(dict), std::move(promise)));
+                                          std::move(cookie_filter),
+                                          std::move(promise)));
   }
 
   return handle;
@@ -4,6 +4,7 @@
 
 #include "shell/browser/api/electron_api_data_pipe_holder.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -15,6 +16,7 @@
 #include "net/base/net_errors.h"
 #include "shell/common/gin_helper/promise.h"
 #include "shell/common/key_weak_map.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 #include "shell/common/node_includes.h"
 
@@ -145,6 +147,148 @@ class DataPipeReader {
 
 }  // namespace
 
+// Utility class to read from data pipe chunk by chunk, used for streaming the
+// data to JS without buffering all of it.
+class DataPipeHolder::StreamReader {
+ public:
+  explicit StreamReader(
+      mojo::Remote<network::mojom::DataPipeGetter> data_pipe_getter)
+      : data_pipe_getter_(std::move(data_pipe_getter)),
+        handle_watcher_(FROM_HERE,
+                        mojo::SimpleWatcher::ArmingPolicy::MANUAL,
+                        base::SequencedTaskRunnerHandle::Get()) {
+    mojo::ScopedDataPipeProducerHandle producer_handle;
+    if (mojo::CreateDataPipe(nullptr, producer_handle, data_pipe_) !=
+        MOJO_RESULT_OK) {
+      failed_ = true;
+      return;
+    }
+    data_pipe_getter_->Read(std::move(producer_handle),
+                            base::BindOnce(&StreamReader::ReadCallback,
+                                           weak_factory_.GetWeakPtr()));
+    handle_watcher_.Watch(data_pipe_.get(), MOJO_HANDLE_SIGNAL_READABLE,
+                          base::BindRepeating(&StreamReader::OnHandleReadable,
+                                              weak_factory_.GetWeakPtr()));
+  }
+
+  ~StreamReader() = default;
+
+  // disable copy
+  StreamReader(const StreamReader&) = delete;
+  StreamReader& operator=(const StreamReader&) = delete;
+
+  void Read(gin_helper::Promise<v8::Local<v8::Value>> promise) {
+    if (pending_read_) {
+      promise.RejectWithErrorMessage("Only one read can be pending at a time");
+      return;
+    }
+    if (failed_) {
+      promise.RejectWithErrorMessage("Could not get blob data");
+      return;
+    }
+    pending_read_ = std::move(promise);
+    if (IsFinished())
+      ResolveWith(v8::Null(pending_read_->isolate()));
+    else if (data_pipe_)
+      handle_watcher_.ArmOrNotify();
+  }
+
+ private:
+  bool IsFinished() const { return size_known_ && remaining_size_ == 0; }
+
+  // Callback invoked by DataPipeGetter::Read.
+  void ReadCallback(int32_t status, uint64_t size) {
+    if (status != net::OK) {
+      OnFailure();
+      return;
+    }
+    size_known_ = true;
+    // Bytes may already have been consumed before the size arrives.
+    remaining_size_ = size > bytes_read_ ? size - bytes_read_ : 0;
+    if (IsFinished()) {
+      if (pending_read_)
+        ResolveWith(v8::Null(pending_read_->isolate()));
+    } else if (!data_pipe_) {
+      // The pipe was closed before all data could be read.
+      OnFailure();
+    }
+  }
+
+  // Called by |handle_watcher_| when data is available or the pipe was closed,
+  // and there's a pending Read() call.
+  void OnHandleReadable(MojoResult result) {
+    if (!pending_read_)
+      return;
+
+    if (result == MOJO_RESULT_OK) {
+      const void* buffer = nullptr;
+      uint32_t length = 0;
+      result = data_pipe_->BeginReadData(&buffer, &length,
+                                         MOJO_READ_DATA_FLAG_NONE);
+      if (result == MOJO_RESULT_OK) {
+        v8::Isolate* isolate = pending_read_->isolate();
+        v8::Locker locker(isolate);
+        v8::HandleScope handle_scope(isolate);
+        v8::Local<v8::Value> chunk =
+            node::Buffer::Copy(isolate, static_cast<const char*>(buffer),
+                               length)
+                .ToLocalChecked();
+        data_pipe_->EndReadData(length);
+        bytes_read_ += length;
+        if (size_known_)
+          remaining_size_ -= std::min<uint64_t>(remaining_size_, length);
+        ResolveWith(chunk);
+        return;
+      }
+    }
+
+    if (result == MOJO_RESULT_SHOULD_WAIT) {  // IO pending
+      handle_watcher_.ArmOrNotify();
+    } else if (IsFinished()) {  // producer closed after writing everything
+      ResolveWith(v8::Null(pending_read_->isolate()));
+    } else if (result == MOJO_RESULT_FAILED_PRECONDITION && !size_known_) {
+      // The pipe was closed before the size was reported, wait for it.
+      handle_watcher_.Cancel();
+      data_pipe_.reset();
+    } else {  // error
+      OnFailure();
+    }
+  }
+
+  void ResolveWith(v8::Local<v8::Value> value) {
+    auto promise = std::move(*pending_read_);
+    pending_read_.reset();
+    v8::Locker locker(promise.isolate());
+    v8::HandleScope handle_scope(promise.isolate());
+    promise.Resolve(value);
+  }
+
+  void OnFailure() {
+    failed_ = true;
+    handle_watcher_.Cancel();
+    data_pipe_.reset();
+    data_pipe_getter_.reset();
+    if (pending_read_) {
+      auto promise = std::move(*pending_read_);
+      pending_read_.reset();
+      promise.RejectWithErrorMessage("Could not get blob data");
+    }
+  }
+
+  absl::optional<gin_helper::Promise<v8::Local<v8::Value>>> pending_read_;
+
+  mojo::Remote<network::mojom::DataPipeGetter> data_pipe_getter_;
+  mojo::ScopedDataPipeConsumerHandle data_pipe_;
+  mojo::SimpleWatcher handle_watcher_;
+
+  bool failed_ = false;
+  bool size_known_ = false;
+  uint64_t bytes_read_ = 0;
+  uint64_t remaining_size_ = 0;
+
+  base::WeakPtrFactory<StreamReader> weak_factory_{this};
+};
+
 gin::WrapperInfo DataPipeHolder::kWrapperInfo = {gin::kEmbedderNativeGin};
 
 DataPipeHolder::DataPipeHolder(const network::DataElement& element)
@@ -167,6 +311,21 @@ v8::Local<v8::Promise> DataPipeHolder::ReadAll(v8::Isolate* isolate) {
   return handle;
 }
 
+v8::Local<v8::Promise> DataPipeHolder::Read(v8::Isolate* isolate) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (!stream_reader_) {
+    if (!data_pipe_) {
+      promise.RejectWithErrorMessage("Could not get blob data");
+      return handle;
+    }
+    stream_reader_ = std::make_unique<StreamReader>(std::move(data_pipe_));
+  }
+
+  stream_reader_->Read(std::move(promise));
+  return handle;
+}
+
 // static
 gin::Handle<DataPipeHolder> DataPipeHolder::Create(
     v8::Isolate* isolate,
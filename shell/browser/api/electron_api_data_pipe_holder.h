@@ -5,6 +5,7 @@
 #ifndef ELECTRON_SHELL_BROWSER_API_ELECTRON_API_DATA_PIPE_HOLDER_H_
 #define ELECTRON_SHELL_BROWSER_API_ELECTRON_API_DATA_PIPE_HOLDER_H_
 
+#include <memory>
 #include <string>
 
 #include "gin/handle.h"
@@ -34,6 +35,11 @@ class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
   // no one has complained about it yet.
   v8::Local<v8::Promise> ReadAll(v8::Isolate* isolate);
 
+  // Read the next chunk of data, the promise resolves with a Buffer holding
+  // whatever is currently available in the pipe, or null when all data has
+  // been consumed. Unlike ReadAll, this never holds the whole body in memory.
+  v8::Local<v8::Promise> Read(v8::Isolate* isolate);
+
   // The unique ID that can be used to receive the object.
   const std::string& id() const { return id_; }
 
@@ -42,11 +48,14 @@ class DataPipeHolder : public gin::Wrappable<DataPipeHolder> {
   DataPipeHolder& operator=(const DataPipeHolder&) = delete;
 
  private:
+  class StreamReader;
+
   explicit DataPipeHolder(const network::DataElement& element);
   ~DataPipeHolder() override;
 
   std::string id_;
   mojo::Remote<network::mojom::DataPipeGetter> data_pipe_;
+  std::unique_ptr<StreamReader> stream_reader_;
 };
 
 }  // namespace api
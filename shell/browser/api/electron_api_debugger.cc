@@ -8,15 +8,17 @@
 #include <string>
 #include <utility>
 
-#include "base/json/json_reader.h"
-#include "base/json/json_writer.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
 #include "content/public/browser/devtools_agent_host.h"
 #include "content/public/browser/web_contents.h"
+#include "gin/dictionary.h"
 #include "gin/object_template_builder.h"
 #include "gin/per_isolate_data.h"
 #include "shell/browser/javascript_environment.h"
-#include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/node_includes.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 using content::DevToolsAgentHost;
 
@@ -24,6 +26,28 @@ namespace electron {
 
 namespace api {
 
+namespace {
+
+bool IsPlainObject(v8::Local<v8::Value> value) {
+  return !value.IsEmpty() && value->IsObject() && !value->IsArray() &&
+         !value->IsFunction();
+}
+
+// Reads the id of a protocol response without parsing the whole message,
+// DevTools always serializes it as the first member.
+absl::optional<int> GetResponseId(base::StringPiece message) {
+  constexpr base::StringPiece kIdPrefix = "{\"id\":";
+  if (!base::StartsWith(message, kIdPrefix))
+    return absl::nullopt;
+  message.remove_prefix(kIdPrefix.size());
+  int id;
+  if (!base::StringToInt(message.substr(0, message.find_first_of(",}")), &id))
+    return absl::nullopt;
+  return id;
+}
+
+}  // namespace
+
 gin::WrapperInfo Debugger::kWrapperInfo = {gin::kEmbedderNativeGin};
 
 Debugger::Debugger(v8::Isolate* isolate, content::WebContents* web_contents)
@@ -46,46 +70,75 @@ void Debugger::DispatchProtocolMessage(DevToolsAgentHost* agent_host,
 
   v8::Locker locker(isolate);
   v8::HandleScope handle_scope(isolate);
-
-  base::StringPiece message_str(reinterpret_cast<const char*>(message.data()),
-                                message.size());
-  std::unique_ptr<base::Value> parsed_message =
-      base::JSONReader::ReadDeprecated(message_str,
-                                       base::JSON_REPLACE_INVALID_CHARACTERS);
-  if (!parsed_message || !parsed_message->is_dict())
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+
+  // Parse the message straight into V8 instead of going through base::Value,
+  // only the fields needed for dispatching are read natively. Invalid UTF-8
+  // sequences are replaced when creating the string.
+  base::StringPiece message_view(reinterpret_cast<const char*>(message.data()),
+                                 message.size());
+  // Settles the command answered by a message that cannot be read, so its
+  // promise does not hang.
+  auto reject_response = [&](base::StringPiece error_message) {
+    absl::optional<int> id = GetResponseId(message_view);
+    if (!id)
+      return;
+    auto it = pending_requests_.find(*id);
+    if (it == pending_requests_.end())
+      return;
+    gin_helper::Promise<v8::Local<v8::Value>> promise = std::move(it->second);
+    pending_requests_.erase(it);
+    promise.RejectWithErrorMessage(error_message);
+  };
+
+  v8::Local<v8::String> message_str;
+  if (!v8::String::NewFromUtf8(isolate, message_view.data(),
+                               v8::NewStringType::kNormal, message_view.size())
+           .ToLocal(&message_str)) {
+    // Longer than v8::String::kMaxLength.
+    reject_response("Protocol message is too large");
     return;
-  auto* dict = static_cast<base::DictionaryValue*>(parsed_message.get());
-  int id;
-  if (!dict->GetInteger("id", &id)) {
+  }
+  v8::Local<v8::Value> parsed_message;
+  {
+    v8::TryCatch try_catch(isolate);
+    if (!v8::JSON::Parse(context, message_str).ToLocal(&parsed_message) ||
+        !IsPlainObject(parsed_message)) {
+      reject_response("Invalid protocol message");
+      return;
+    }
+  }
+  gin::Dictionary dict(isolate, parsed_message.As<v8::Object>());
+
+  v8::Local<v8::Value> id;
+  if (!dict.Get("id", &id) || !id->IsInt32()) {
     std::string method;
-    if (!dict->GetString("method", &method))
+    if (!dict.Get("method", &method))
       return;
     std::string session_id;
-    dict->GetString("sessionId", &session_id);
-    base::DictionaryValue* params_value = nullptr;
-    base::DictionaryValue params;
-    if (dict->GetDictionary("params", &params_value))
-      params.Swap(params_value);
+    dict.Get("sessionId", &session_id);
+    v8::Local<v8::Value> params;
+    if (!dict.Get("params", &params) || !IsPlainObject(params))
+      params = v8::Object::New(isolate);
     Emit("message", method, params, session_id);
   } else {
-    auto it = pending_requests_.find(id);
+    auto it = pending_requests_.find(id.As<v8::Int32>()->Value());
     if (it == pending_requests_.end())
       return;
 
-    gin_helper::Promise<base::DictionaryValue> promise = std::move(it->second);
+    gin_helper::Promise<v8::Local<v8::Value>> promise = std::move(it->second);
     pending_requests_.erase(it);
 
-    base::DictionaryValue* error = nullptr;
-    if (dict->GetDictionary("error", &error)) {
+    v8::Local<v8::Value> error;
+    if (dict.Get("error", &error) && IsPlainObject(error)) {
       std::string message;
-      error->GetString("message", &message);
+      gin::Dictionary(isolate, error.As<v8::Object>())
+          .Get("message", &message);
       promise.RejectWithErrorMessage(message);
     } else {
-      base::DictionaryValue* result_body = nullptr;
-      base::DictionaryValue result;
-      if (dict->GetDictionary("result", &result_body)) {
-        result.Swap(result_body);
-      }
+      v8::Local<v8::Value> result;
+      if (!dict.Get("result", &result) || !IsPlainObject(result))
+        result = v8::Object::New(isolate);
       promise.Resolve(result);
     }
   }
@@ -137,7 +190,7 @@ void Debugger::Detach() {
 
 v8::Local<v8::Promise> Debugger::SendCommand(gin::Arguments* args) {
   v8::Isolate* isolate = args->isolate();
-  gin_helper::Promise<base::DictionaryValue> promise(isolate);
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
   v8::Local<v8::Promise> handle = promise.GetHandle();
 
   if (!agent_host_) {
@@ -151,7 +204,7 @@ v8::Local<v8::Promise> Debugger::SendCommand(gin::Arguments* args) {
     return handle;
   }
 
-  base::DictionaryValue command_params;
+  v8::Local<v8::Value> command_params;
   args->GetNext(&command_params);
 
   std::string session_id;
@@ -160,24 +213,38 @@ v8::Local<v8::Promise> Debugger::SendCommand(gin::Arguments* args) {
     return handle;
   }
 
-  base::DictionaryValue request;
+  // Serialize the command straight from V8 instead of converting it to a
+  // base::Value first.
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  gin::Dictionary request = gin::Dictionary::CreateEmpty(isolate);
   int request_id = ++previous_request_id_;
-  pending_requests_.emplace(request_id, std::move(promise));
-  request.SetInteger("id", request_id);
-  request.SetString("method", method);
-  if (!command_params.DictEmpty()) {
-    request.Set("params",
-                base::Value::ToUniquePtrValue(command_params.Clone()));
+  request.Set("id", request_id);
+  request.Set("method", method);
+  if (IsPlainObject(command_params) &&
+      command_params.As<v8::Object>()
+              ->GetOwnPropertyNames(context)
+              .ToLocalChecked()
+              ->Length() > 0) {
+    request.Set("params", command_params);
   }
 
   if (!session_id.empty()) {
-    request.SetString("sessionId", session_id);
+    request.Set("sessionId", session_id);
   }
 
-  std::string json_args;
-  base::JSONWriter::Write(request, &json_args);
-  agent_host_->DispatchProtocolMessage(
-      this, base::as_bytes(base::make_span(json_args)));
+  v8::Local<v8::String> json_args;
+  {
+    v8::TryCatch try_catch(isolate);
+    if (!v8::JSON::Stringify(context, gin::ConvertToV8(isolate, request))
+             .ToLocal(&json_args)) {
+      promise.RejectWithErrorMessage("Invalid command parameters");
+      return handle;
+    }
+  }
+  pending_requests_.emplace(request_id, std::move(promise));
+  std::string json = gin::V8ToString(isolate, json_args);
+  agent_host_->DispatchProtocolMessage(this,
+                                       base::as_bytes(base::make_span(json)));
 
   return handle;
 }
@@ -59,7 +59,7 @@ class Debugger : public gin::Wrappable<Debugger>,
 
  private:
   using PendingRequestMap =
-      std::map<int, gin_helper::Promise<base::DictionaryValue>>;
+      std::map<int, gin_helper::Promise<v8::Local<v8::Value>>>;
 
   void Attach(gin::Arguments* args);
   bool IsAttached();
@@ -54,6 +54,7 @@
 #include "shell/browser/api/electron_api_service_worker_context.h"
 #include "shell/browser/api/electron_api_web_request.h"
 #include "shell/browser/browser.h"
+#include "shell/browser/electron_browser_client.h"
 #include "shell/browser/electron_browser_context.h"
 #include "shell/browser/electron_browser_main_parts.h"
 #include "shell/browser/electron_permission_manager.h"
@@ -61,6 +62,7 @@
 #include "shell/browser/media/media_device_id_salt.h"
 #include "shell/browser/net/cert_verifier_client.h"
 #include "shell/browser/session_preferences.h"
+#include "shell/browser/web_contents_preferences.h"
 #include "shell/common/gin_converters/callback_converter.h"
 #include "shell/common/gin_converters/content_converter.h"
 #include "shell/common/gin_converters/file_path_converter.h"
@@ -735,6 +737,18 @@ v8::Local<v8::Promise> Session::GetBlobData(v8::Isolate* isolate,
   return holder->ReadAll(isolate);
 }
 
+v8::Local<v8::Promise> Session::ReadBlobData(v8::Isolate* isolate,
+                                             const std::string& uuid) {
+  gin::Handle<DataPipeHolder> holder = DataPipeHolder::From(isolate, uuid);
+  if (holder.IsEmpty()) {
+    gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+    promise.RejectWithErrorMessage("Could not get blob data handle");
+    return promise.GetHandle();
+  }
+
+  return holder->Read(isolate);
+}
+
 void Session::DownloadURL(const GURL& url) {
   auto* download_manager = browser_context()->GetDownloadManager();
   auto download_params = std::make_unique<download::DownloadUrlParameters>(
@@ -784,6 +798,30 @@ std::vector<base::FilePath> Session::GetPreloads() const {
   return prefs->preloads();
 }
 
+void Session::SetSpareRendererPreferences(v8::Local<v8::Value> val,
+                                          gin::Arguments* args) {
+  gin_helper::Dictionary web_preferences;
+  if (!(val->IsNull() ||
+        gin::ConvertFromV8(args->isolate(), val, &web_preferences))) {
+    args->ThrowTypeError("Must pass null or object");
+    return;
+  }
+
+  // A spare launched with the old preferences must not be handed out.
+  auto* browser_client = ElectronBrowserClient::Get();
+  browser_client->DiscardSpareRenderer(browser_context());
+
+  auto* prefs = SessionPreferences::FromBrowserContext(browser_context());
+  DCHECK(prefs);
+  if (val->IsNull()) {
+    prefs->set_spare_renderer_sandboxed(absl::nullopt);
+    return;
+  }
+  prefs->set_spare_renderer_sandboxed(
+      WebContentsPreferences::IsSandboxed(browser_context(), web_preferences));
+  browser_client->WarmupSpareRenderer(browser_context());
+}
+
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
 v8::Local<v8::Promise> Session::LoadExtension(
     const base::FilePath& extension_path,
@@ -1171,11 +1209,14 @@ gin::ObjectTemplateBuilder Session::GetObjectTemplateBuilder(
       .SetMethod("getUserAgent", &Session::GetUserAgent)
       .SetMethod("setSSLConfig", &Session::SetSSLConfig)
       .SetMethod("getBlobData", &Session::GetBlobData)
+      .SetMethod("readBlobData", &Session::ReadBlobData)
       .SetMethod("downloadURL", &Session::DownloadURL)
       .SetMethod("createInterruptedDownload",
                  &Session::CreateInterruptedDownload)
       .SetMethod("setPreloads", &Session::SetPreloads)
       .SetMethod("getPreloads", &Session::GetPreloads)
+      .SetMethod("setSpareRendererPreferences",
+                 &Session::SetSpareRendererPreferences)
 #if BUILDFLAG(ENABLE_ELECTRON_EXTENSIONS)
       .SetMethod("loadExtension", &Session::LoadExtension)
       .SetMethod("removeExtension", &Session::RemoveExtension)
@@ -11,12 +11,14 @@
 #include <vector>
 
 #include "base/no_destructor.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "gin/wrappable.h"
 #include "mojo/public/cpp/bindings/remote.h"
 #include "mojo/public/cpp/system/data_pipe_producer.h"
 #include "net/base/load_flags.h"
+#include "net/http/http_response_info.h"
 #include "net/http/http_util.h"
 #include "services/network/public/cpp/resource_request.h"
 #include "services/network/public/cpp/simple_url_loader.h"
@@ -244,6 +246,10 @@ class JSChunkedDataPipeGetter : public gin::Wrappable<JSChunkedDataPipeGetter>,
 gin::WrapperInfo JSChunkedDataPipeGetter::kWrapperInfo = {
     gin::kEmbedderNativeGin};
 
+// Small reads are coalesced into chunks of up to this size before being
+// emitted to JS.
+constexpr size_t kCoalesceThreshold = 64 * 1024;
+
 const net::NetworkTrafficAnnotationTag kTrafficAnnotation =
     net::DefineNetworkTrafficAnnotation("electron_net_module", R"(
         semantics {
@@ -384,6 +390,9 @@ void SimpleURLLoaderWrapper::Clone(
 
 void SimpleURLLoaderWrapper::Cancel() {
   loader_.reset();
+  pending_data_.clear();
+  held_resume_.Reset();
+  complete_pending_ = false;
   pinned_wrapper_.Reset();
   pinned_chunk_pipe_getter_.Reset();
   // This ensures that no further callbacks will be called, so there's no need
@@ -414,6 +423,23 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
     request->trusted_params->has_user_activation = has_user_activation;
   }
 
+  std::string priority;
+  if (opts.Get("priority", &priority) && !priority.empty()) {
+    if (priority == "throttled") {
+      request->priority = net::THROTTLED;
+    } else if (priority == "idle") {
+      request->priority = net::IDLE;
+    } else if (priority == "lowest") {
+      request->priority = net::LOWEST;
+    } else if (priority == "low") {
+      request->priority = net::LOW;
+    } else if (priority == "medium") {
+      request->priority = net::MEDIUM;
+    } else if (priority == "highest") {
+      request->priority = net::HIGHEST;
+    }
+  }
+
   std::string mode;
   if (opts.Get("mode", &mode) && !mode.empty()) {
     if (mode == "navigate") {
@@ -548,19 +574,113 @@ gin::Handle<SimpleURLLoaderWrapper> SimpleURLLoaderWrapper::Create(
 void SimpleURLLoaderWrapper::OnDataReceived(base::StringPiece string_piece,
                                             base::OnceClosure resume) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  // Responses are usually delivered in many small reads, emitting each of them
+  // as its own ArrayBuffer is expensive both in copying and in GC pressure.
+  // So while JS is idle we keep reading ahead and coalesce the small reads,
+  // while JS is busy we stop reading, so that no more than
+  // |kCoalesceThreshold| plus one read is ever buffered here.
+  //
+  // The read points into the data pipe and is only valid until |resume| is
+  // run, so it is copied once, into the buffer that is later handed to V8.
+  if (pending_data_.empty()) {
+    // Size the buffer for the rest of the response when it is known, so that
+    // coalescing does not reallocate, small responses do not get a full
+    // threshold worth of memory.
+    size_t capacity = string_piece.size();
+    if (content_length_ > 0 &&
+        static_cast<uint64_t>(content_length_) > bytes_received_) {
+      capacity = std::max(
+          capacity,
+          static_cast<size_t>(std::min<uint64_t>(
+              content_length_ - bytes_received_, kCoalesceThreshold)));
+    }
+    pending_data_.reserve(capacity);
+  }
+  bytes_received_ += string_piece.size();
+  pending_data_.insert(pending_data_.end(), string_piece.begin(),
+                       string_piece.end());
+  held_resume_ = std::move(resume);
+  if (js_busy_)
+    return;
+  if (pending_data_.size() >= kCoalesceThreshold) {
+    EmitPendingData();
+    return;
+  }
+  // Read more in a new task to avoid re-entrancy, and make sure what we have
+  // is delivered if nothing else is immediately available.
+  base::SequencedTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&SimpleURLLoaderWrapper::ReadAhead,
+                                weak_factory_.GetWeakPtr()));
+  if (!flush_scheduled_) {
+    flush_scheduled_ = true;
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::BindOnce(&SimpleURLLoaderWrapper::FlushPendingData,
+                                  weak_factory_.GetWeakPtr()));
+  }
+}
+
+void SimpleURLLoaderWrapper::ReadAhead() {
+  if (held_resume_ && !js_busy_)
+    std::move(held_resume_).Run();
+}
+
+void SimpleURLLoaderWrapper::FlushPendingData() {
+  flush_scheduled_ = false;
+  if (!js_busy_ && !pending_data_.empty())
+    EmitPendingData();
+}
+
+void SimpleURLLoaderWrapper::EmitPendingData() {
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
-  auto array_buffer = v8::ArrayBuffer::New(isolate, string_piece.size());
-  auto backing_store = array_buffer->GetBackingStore();
-  memcpy(backing_store->Data(), string_piece.data(), string_piece.size());
+  // Hand the buffer over to V8 instead of copying it, it is freed when the
+  // ArrayBuffer gets garbage collected.
+  auto* data = new std::vector<char>(std::move(pending_data_));
+  pending_data_.clear();
+  auto backing_store = v8::ArrayBuffer::NewBackingStore(
+      data->data(), data->size(),
+      [](void*, size_t, void* deleter_data) {
+        delete static_cast<std::vector<char>*>(deleter_data);
+      },
+      data);
+  auto array_buffer = v8::ArrayBuffer::New(isolate, std::move(backing_store));
+  js_busy_ = true;
   Emit("data", array_buffer,
-       base::AdaptCallbackForRepeating(std::move(resume)));
+       base::BindRepeating(&SimpleURLLoaderWrapper::OnDataConsumed,
+                           weak_factory_.GetWeakPtr(), ++emit_id_));
+}
+
+void SimpleURLLoaderWrapper::OnDataConsumed(uint64_t emit_id) {
+  // Ignore stale or repeated calls of the resume callback.
+  if (!js_busy_ || emit_id != emit_id_)
+    return;
+  js_busy_ = false;
+  if (!pending_data_.empty()) {
+    EmitPendingData();
+  } else if (held_resume_) {
+    std::move(held_resume_).Run();
+  } else if (complete_pending_) {
+    complete_pending_ = false;
+    Emit("complete");
+    pinned_wrapper_.Reset();
+    pinned_chunk_pipe_getter_.Reset();
+  }
 }
 
 void SimpleURLLoaderWrapper::OnComplete(bool success) {
   if (success) {
+    if (!js_busy_ && !pending_data_.empty())
+      EmitPendingData();
+    // 'complete' must come after the last 'data', so while JS has not
+    // consumed it, it is emitted from OnDataConsumed.
+    if (js_busy_) {
+      complete_pending_ = true;
+      loader_.reset();
+      return;
+    }
     Emit("complete");
   } else {
+    pending_data_.clear();
     Emit("error", net::ErrorToString(loader_->NetError()));
   }
   loader_.reset();
@@ -573,6 +693,7 @@ void SimpleURLLoaderWrapper::OnRetry(base::OnceClosure start_retry) {}
 void SimpleURLLoaderWrapper::OnResponseStarted(
     const GURL& final_url,
     const network::mojom::URLResponseHead& response_head) {
+  content_length_ = response_head.content_length;
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope scope(isolate);
   gin::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
@@ -583,6 +704,11 @@ void SimpleURLLoaderWrapper::OnResponseStarted(
   // be used here.
   DCHECK(!response_head.raw_response_headers.empty());
   dict.Set("rawHeaders", response_head.raw_response_headers);
+  // Lets callers see whether requests are multiplexed over HTTP/2 or QUIC and
+  // whether connections are being reused.
+  dict.Set("connectionInfo", net::HttpResponseInfo::ConnectionInfoToString(
+                                 response_head.connection_info));
+  dict.Set("socketReused", response_head.load_timing.socket_reused);
   Emit("response-started", final_url, dict);
 }
 
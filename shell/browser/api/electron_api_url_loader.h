@@ -110,6 +110,12 @@ class SimpleURLLoaderWrapper
   void OnUploadProgress(uint64_t position, uint64_t total);
   void OnDownloadProgress(uint64_t current);
 
+  // Data coalescing, see OnDataReceived.
+  void ReadAhead();
+  void FlushPendingData();
+  void EmitPendingData();
+  void OnDataConsumed(uint64_t emit_id);
+
   void Start();
   void Pin();
   void PinBodyGetter(v8::Local<v8::Value>);
@@ -118,6 +124,22 @@ class SimpleURLLoaderWrapper
   v8::Global<v8::Value> pinned_wrapper_;
   v8::Global<v8::Value> pinned_chunk_pipe_getter_;
 
+  // Response data that has been read but not yet handed to JS.
+  std::vector<char> pending_data_;
+  // The resume closure of |loader_|, held while we wait for JS to consume
+  // the data emitted previously.
+  base::OnceClosure held_resume_;
+  // Whether JS has not yet consumed the last emitted chunk.
+  bool js_busy_ = false;
+  bool flush_scheduled_ = false;
+  // Whether the response completed while JS was still busy, 'complete' is
+  // then emitted once it has consumed the last chunk.
+  bool complete_pending_ = false;
+  uint64_t emit_id_ = 0;
+  // The Content-Length of the response, or -1 when unknown.
+  int64_t content_length_ = -1;
+  uint64_t bytes_received_ = 0;
+
   mojo::ReceiverSet<network::mojom::URLLoaderNetworkServiceObserver>
       url_loader_network_observer_receivers_;
   base::WeakPtrFactory<SimpleURLLoaderWrapper> weak_factory_{this};
@@ -117,6 +117,7 @@
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/ipc_channel_metrics.h"
 #include "shell/common/language_util.h"
 #include "shell/common/mouse_util.h"
 #include "shell/common/node_includes.h"
@@ -741,6 +742,12 @@ WebContents::WebContents(v8::Isolate* isolate,
   }
   session_.Reset(isolate, session.ToV8());
 
+  // Let the initial frame claim a spare renderer launched with matching
+  // preferences, see ElectronBrowserClient::ShouldUseSpareRenderProcessHost.
+  auto* browser_client = ElectronBrowserClient::Get();
+  if (!IsGuest())
+    browser_client->set_pending_web_preferences(&options);
+
   std::unique_ptr<content::WebContents> web_contents;
   if (IsGuest()) {
     scoped_refptr<content::SiteInstance> site_instance =
@@ -790,6 +797,7 @@ WebContents::WebContents(v8::Isolate* isolate,
     params.initially_hidden = !initially_shown;
     web_contents = content::WebContents::Create(params);
   }
+  browser_client->set_pending_web_preferences(nullptr);
 
   InitWithSessionAndOptions(isolate, std::move(web_contents), session, options);
 }
@@ -1748,6 +1756,7 @@ void WebContents::Message(bool internal,
                           blink::CloneableMessage arguments,
                           content::RenderFrameHost* render_frame_host) {
   TRACE_EVENT1("electron", "WebContents::Message", "channel", channel);
+  ScopedIPCChannelReceive metrics(channel, arguments.encoded_message.size());
   // webContents.emit('-ipc-message', new Event(), internal, channel,
   // arguments);
   EmitWithSender("-ipc-message", render_frame_host,
@@ -1762,6 +1771,7 @@ void WebContents::Invoke(
     electron::mojom::ElectronBrowser::InvokeCallback callback,
     content::RenderFrameHost* render_frame_host) {
   TRACE_EVENT1("electron", "WebContents::Invoke", "channel", channel);
+  ScopedIPCChannelReceive metrics(channel, arguments.encoded_message.size());
   // webContents.emit('-ipc-invoke', new Event(), internal, channel, arguments);
   EmitWithSender("-ipc-invoke", render_frame_host, std::move(callback),
                  internal, channel, std::move(arguments));
@@ -1796,6 +1806,7 @@ void WebContents::MessageSync(
     electron::mojom::ElectronBrowser::MessageSyncCallback callback,
     content::RenderFrameHost* render_frame_host) {
   TRACE_EVENT1("electron", "WebContents::MessageSync", "channel", channel);
+  ScopedIPCChannelReceive metrics(channel, arguments.encoded_message.size());
   // webContents.emit('-ipc-message-sync', new Event(sender, message), internal,
   // channel, arguments);
   EmitWithSender("-ipc-message-sync", render_frame_host, std::move(callback),
@@ -1825,10 +1836,38 @@ void WebContents::MessageTo(int32_t web_contents_id,
   }
 }
 
+void WebContents::ConnectMessageTo(
+    int32_t web_contents_id,
+    mojo::PendingReceiver<mojom::ElectronMessageTarget> receiver) {
+  TRACE_EVENT1("electron", "WebContents::ConnectMessageTo", "target",
+               web_contents_id);
+  // Dropping |receiver| closes the pipe, which the sender treats the same way
+  // as MessageTo treats a missing target.
+  auto* target_web_contents = FromID(web_contents_id);
+  if (!target_web_contents)
+    return;
+
+  content::RenderFrameHost* frame = target_web_contents->MainFrame();
+  DCHECK(frame);
+
+  v8::HandleScope handle_scope(JavascriptEnvironment::GetIsolate());
+  gin::Handle<WebFrameMain> web_frame_main =
+      WebFrameMain::From(JavascriptEnvironment::GetIsolate(), frame);
+
+  if (!web_frame_main->CheckRenderFrame())
+    return;
+
+  // The sender ID is stamped here rather than by the sending renderer, so a
+  // direct pipe can not be used to impersonate another WebContents.
+  web_frame_main->GetRendererApi()->BindMessageTarget(ID(),
+                                                      std::move(receiver));
+}
+
 void WebContents::MessageHost(const std::string& channel,
                               blink::CloneableMessage arguments,
                               content::RenderFrameHost* render_frame_host) {
   TRACE_EVENT1("electron", "WebContents::MessageHost", "channel", channel);
+  ScopedIPCChannelReceive metrics(channel, arguments.encoded_message.size());
   // webContents.emit('ipc-message-host', new Event(), channel, args);
   EmitWithSender("ipc-message-host", render_frame_host,
                  electron::mojom::ElectronBrowser::InvokeCallback(), channel,
@@ -422,6 +422,9 @@ class WebContents : public ExclusiveAccessContext,
   void MessageTo(int32_t web_contents_id,
                  const std::string& channel,
                  blink::CloneableMessage arguments);
+  void ConnectMessageTo(
+      int32_t web_contents_id,
+      mojo::PendingReceiver<mojom::ElectronMessageTarget> receiver);
   void MessageHost(const std::string& channel,
                    blink::CloneableMessage arguments,
                    content::RenderFrameHost* render_frame_host);
@@ -11,6 +11,7 @@
 
 #include "base/logging.h"
 #include "base/no_destructor.h"
+#include "base/time/time.h"
 #include "content/browser/renderer_host/frame_tree_node.h"  // nogncheck
 #include "content/public/browser/render_frame_host.h"
 #include "electron/shell/common/api/api.mojom.h"
@@ -27,6 +28,7 @@
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/object_template_builder.h"
 #include "shell/common/gin_helper/promise.h"
+#include "shell/common/ipc_channel_metrics.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/v8_value_serializer.h"
 
@@ -167,12 +169,15 @@ void WebFrameMain::Send(v8::Isolate* isolate,
                         bool internal,
                         const std::string& channel,
                         v8::Local<v8::Value> args) {
+  base::TimeTicks start = base::TimeTicks::Now();
   blink::CloneableMessage message;
   if (!gin::ConvertFromV8(isolate, args, &message)) {
     isolate->ThrowException(v8::Exception::Error(
         gin::StringToV8(isolate, "Failed to serialize arguments")));
     return;
   }
+  IPCChannelMetrics::GetInstance()->RecordSent(
+      channel, message.encoded_message.size(), base::TimeTicks::Now() - start);
 
   if (!CheckRenderFrame())
     return;
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "base/stl_util.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
 #include "extensions/browser/api/web_request/web_request_resource_type.h"
 #include "gin/converter.h"
@@ -268,6 +269,11 @@ WebRequest::WebRequest(v8::Isolate* isolate,
 }
 
 WebRequest::~WebRequest() {
+  for (const auto& it : callbacks_) {
+    TRACE_EVENT_NESTABLE_ASYNC_END1("electron", "WebRequest::ResponseListener",
+                                    TRACE_ID_LOCAL(it.first), "result",
+                                    "aborted");
+  }
   browser_context_->RemoveUserData(kUserDataKey);
 }
 
@@ -359,7 +365,7 @@ void WebRequest::OnResponseStarted(extensions::WebRequestInfo* info,
 void WebRequest::OnErrorOccurred(extensions::WebRequestInfo* info,
                                  const network::ResourceRequest& request,
                                  int net_error) {
-  callbacks_.erase(info->id);
+  ClearCallback(info->id);
 
   HandleSimpleEvent(SimpleEvent::kOnErrorOccurred, info, request, net_error);
 }
@@ -367,13 +373,48 @@ void WebRequest::OnErrorOccurred(extensions::WebRequestInfo* info,
 void WebRequest::OnCompleted(extensions::WebRequestInfo* info,
                              const network::ResourceRequest& request,
                              int net_error) {
-  callbacks_.erase(info->id);
+  ClearCallback(info->id);
 
   HandleSimpleEvent(SimpleEvent::kOnCompleted, info, request, net_error);
 }
 
 void WebRequest::OnRequestWillBeDestroyed(extensions::WebRequestInfo* info) {
-  callbacks_.erase(info->id);
+  ClearCallback(info->id);
+}
+
+void WebRequest::ClearCallback(uint64_t id) {
+  if (!callbacks_.erase(id))
+    return;
+  TRACE_EVENT_NESTABLE_ASYNC_END1("electron", "WebRequest::ResponseListener",
+                                  TRACE_ID_LOCAL(id), "result", "aborted");
+}
+
+// static
+const char* WebRequest::GetEventName(SimpleEvent event) {
+  switch (event) {
+    case SimpleEvent::kOnSendHeaders:
+      return "onSendHeaders";
+    case SimpleEvent::kOnBeforeRedirect:
+      return "onBeforeRedirect";
+    case SimpleEvent::kOnResponseStarted:
+      return "onResponseStarted";
+    case SimpleEvent::kOnCompleted:
+      return "onCompleted";
+    case SimpleEvent::kOnErrorOccurred:
+      return "onErrorOccurred";
+  }
+}
+
+// static
+const char* WebRequest::GetEventName(ResponseEvent event) {
+  switch (event) {
+    case ResponseEvent::kOnBeforeRequest:
+      return "onBeforeRequest";
+    case ResponseEvent::kOnBeforeSendHeaders:
+      return "onBeforeSendHeaders";
+    case ResponseEvent::kOnHeadersReceived:
+      return "onHeadersReceived";
+  }
 }
 
 template <WebRequest::SimpleEvent event>
@@ -448,6 +489,8 @@ void WebRequest::HandleSimpleEvent(SimpleEvent event,
   if (!MatchesFilterCondition(request_info, info.url_patterns))
     return;
 
+  TRACE_EVENT1("electron", "WebRequest::HandleSimpleEvent", "event",
+               GetEventName(event));
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
   gin_helper::Dictionary details(isolate, v8::Object::New(isolate));
@@ -471,6 +514,11 @@ int WebRequest::HandleResponseEvent(ResponseEvent event,
 
   callbacks_[request_info->id] = std::move(callback);
 
+  // Spans the round trip until the JS listener calls back.
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1("electron", "WebRequest::ResponseListener",
+                                    TRACE_ID_LOCAL(request_info->id), "event",
+                                    GetEventName(event));
+
   v8::Isolate* isolate = JavascriptEnvironment::GetIsolate();
   v8::HandleScope handle_scope(isolate);
   gin_helper::Dictionary details(isolate, v8::Object::New(isolate));
@@ -503,6 +551,9 @@ void WebRequest::OnListenerResult(uint64_t id,
     else
       ReadFromResponse(isolate, &dict, out);
   }
+  TRACE_EVENT_NESTABLE_ASYNC_END1("electron", "WebRequest::ResponseListener",
+                                  TRACE_ID_LOCAL(id), "result",
+                                  result == net::OK ? "continue" : "cancel");
 
   // The ProxyingURLLoaderFactory expects the callback to be executed
   // asynchronously, because it used to work on IO thread before NetworkService.
@@ -125,6 +125,13 @@ class WebRequest : public gin::Wrappable<WebRequest>, public WebRequestAPI {
   template <typename T>
   void OnListenerResult(uint64_t id, T out, v8::Local<v8::Value> response);
 
+  // Drops the callback of request |id| when the request goes away before its
+  // listener called back.
+  void ClearCallback(uint64_t id);
+
+  static const char* GetEventName(SimpleEvent event);
+  static const char* GetEventName(ResponseEvent event);
+
   struct SimpleListenerInfo {
     std::set<URLPattern> url_patterns;
     SimpleListener listener;
@@ -4,11 +4,24 @@
 
 #include "shell/browser/api/process_metric.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
+#if BUILDFLAG(IS_LINUX)
+#include <unistd.h>
+
+#include "base/files/file_util.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_split.h"
+#include "base/strings/string_util.h"
+#endif
+
 #if BUILDFLAG(IS_WIN)
 #include <windows.h>
 
@@ -48,6 +61,34 @@ absl::optional<mach_task_basic_info_data_t> GetTaskInfo(mach_port_t task) {
 
 #endif  // BUILDFLAG(IS_MAC)
 
+#if BUILDFLAG(IS_LINUX)
+
+namespace {
+
+// Calls |callback| with the key and the value in bytes of each "Key: N kB"
+// line in |content|, the format of /proc/<pid>/status and smaps_rollup.
+template <typename Callback>
+void ForEachKilobyteEntry(base::StringPiece content, Callback callback) {
+  for (base::StringPiece line : base::SplitStringPiece(
+           content, "\n", base::KEEP_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+    size_t colon = line.find(':');
+    if (colon == base::StringPiece::npos)
+      continue;
+    base::StringPiece value = base::TrimWhitespaceASCII(
+        line.substr(colon + 1), base::TRIM_ALL);
+    if (!base::EndsWith(value, " kB"))
+      continue;
+    value.remove_suffix(3);
+    size_t kb;
+    if (base::StringToSizeT(value, &kb))
+      callback(line.substr(0, colon), kb << 10);
+  }
+}
+
+}  // namespace
+
+#endif  // BUILDFLAG(IS_LINUX)
+
 namespace electron {
 
 ProcessMetric::ProcessMetric(int type,
@@ -169,4 +210,63 @@ bool ProcessMetric::IsSandboxed() const {
 
 #endif  // BUILDFLAG(IS_MAC)
 
+#if BUILDFLAG(IS_LINUX)
+
+// static
+ProcessMemoryInfo ProcessMetric::ReadMemoryInfo(base::ProcessId pid,
+                                                bool detailed) {
+  ProcessMemoryInfo result;
+  base::FilePath proc_dir("/proc/" + base::NumberToString(pid));
+
+  // The peak working set is only reported in status.
+  std::string status;
+  if (!base::ReadFileToString(proc_dir.Append("status"), &status))
+    return result;
+  ForEachKilobyteEntry(status, [&](base::StringPiece key, size_t bytes) {
+    if (key == "VmRSS")
+      result.working_set_size = bytes;
+    else if (key == "VmHWM")
+      result.peak_working_set_size = bytes;
+    else if (key == "VmSwap")
+      result.swap_bytes = bytes;
+  });
+  if (!detailed)
+    return result;
+
+  // smaps_rollup (Linux 4.14+) sums up smaps without listing every mapping.
+  std::string rollup;
+  if (base::ReadFileToString(proc_dir.Append("smaps_rollup"), &rollup)) {
+    ForEachKilobyteEntry(rollup, [&](base::StringPiece key, size_t bytes) {
+      if (key == "Rss")
+        result.working_set_size = bytes;
+      else if (key == "Private_Clean" || key == "Private_Dirty")
+        result.private_bytes += bytes;
+      else if (key == "Shared_Clean" || key == "Shared_Dirty")
+        result.shared_bytes += bytes;
+      else if (key == "Swap")
+        result.swap_bytes = bytes;
+    });
+    return result;
+  }
+
+  // Fall back to statm, which counts resident and shared pages.
+  std::string statm;
+  if (!base::ReadFileToString(proc_dir.Append("statm"), &statm))
+    return result;
+  std::vector<base::StringPiece> fields = base::SplitStringPiece(
+      statm, " ", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
+  size_t resident_pages, shared_pages;
+  if (fields.size() < 3 || !base::StringToSizeT(fields[1], &resident_pages) ||
+      !base::StringToSizeT(fields[2], &shared_pages))
+    return result;
+  const size_t page_size = getpagesize();
+  result.working_set_size = resident_pages * page_size;
+  result.shared_bytes = shared_pages * page_size;
+  result.private_bytes =
+      (resident_pages - std::min(resident_pages, shared_pages)) * page_size;
+  return result;
+}
+
+#endif  // BUILDFLAG(IS_LINUX)
+
 }  // namespace electron
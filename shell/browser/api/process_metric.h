@@ -14,15 +14,17 @@
 
 namespace electron {
 
-#if !BUILDFLAG(IS_LINUX)
 struct ProcessMemoryInfo {
   size_t working_set_size = 0;
   size_t peak_working_set_size = 0;
-#if BUILDFLAG(IS_WIN)
+#if BUILDFLAG(IS_WIN) || BUILDFLAG(IS_LINUX)
   size_t private_bytes = 0;
 #endif
-};
+#if BUILDFLAG(IS_LINUX)
+  size_t shared_bytes = 0;
+  size_t swap_bytes = 0;
 #endif
+};
 
 #if BUILDFLAG(IS_WIN)
 enum class ProcessIntegrityLevel {
@@ -48,7 +50,12 @@ struct ProcessMetric {
                 const std::string& name = std::string());
   ~ProcessMetric();
 
-#if !BUILDFLAG(IS_LINUX)
+#if BUILDFLAG(IS_LINUX)
+  // Reads the memory usage of |pid| from procfs, this blocks so it should be
+  // called off the UI thread. Only the working set sizes from status are read
+  // unless |detailed| is set.
+  static ProcessMemoryInfo ReadMemoryInfo(base::ProcessId pid, bool detailed);
+#else
   ProcessMemoryInfo GetMemoryInfo() const;
 #endif
 
@@ -20,6 +20,7 @@
 #include "base/lazy_instance.h"
 #include "base/no_destructor.h"
 #include "base/path_service.h"
+#include "base/process/process_handle.h"
 #include "base/stl_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
@@ -49,6 +50,7 @@
 #include "content/public/common/content_descriptors.h"
 #include "content/public/common/content_paths.h"
 #include "content/public/common/content_switches.h"
+#include "content/public/common/result_codes.h"
 #include "content/public/common/url_constants.h"
 #include "crypto/crypto_buildflags.h"
 #include "electron/buildflags/buildflags.h"
@@ -361,6 +363,16 @@ int GetCrashSignalFD(const base::CommandLine& command_line) {
 }
 #endif  // BUILDFLAG(IS_LINUX)
 
+// Returns an empty command line holding the global switches that influence
+// how WebContentsPreferences appends its renderer switches.
+base::CommandLine CreateRendererSwitches() {
+  base::CommandLine command_line(base::CommandLine::NO_PROGRAM);
+  static const char* const kSwitchNames[] = {switches::kEnableSandbox};
+  command_line.CopySwitchesFrom(*base::CommandLine::ForCurrentProcess(),
+                                kSwitchNames, base::size(kSwitchNames));
+  return command_line;
+}
+
 }  // namespace
 
 // static
@@ -490,7 +502,12 @@ void ElectronBrowserClient::RegisterPendingSiteInstance(
     content::SiteInstance* pending_site_instance) {
   // Remember the original web contents for the pending renderer process.
   auto* web_contents = content::WebContents::FromRenderFrameHost(rfh);
+  // Only main frames can claim the spare renderer, let
+  // ShouldUseSpareRenderProcessHost know who is asking for a process.
+  if (!rfh->GetParent())
+    pending_web_contents_ = web_contents;
   auto* pending_process = pending_site_instance->GetProcess();
+  pending_web_contents_ = nullptr;
   pending_processes_[pending_process->GetID()] = web_contents;
 
   if (rfh->GetParent())
@@ -499,6 +516,45 @@ void ElectronBrowserClient::RegisterPendingSiteInstance(
     renderer_is_subframe_.erase(pending_process->GetID());
 }
 
+void ElectronBrowserClient::WarmupSpareRenderer(
+    ElectronBrowserContext* browser_context) {
+  auto* prefs = SessionPreferences::FromBrowserContext(browser_context);
+  if (!prefs || !prefs->spare_renderer_sandboxed())
+    return;
+  // The command line of the spare renderer is built synchronously while it is
+  // being launched, see AppendExtraCommandLineSwitches.
+  launching_spare_renderer_ = prefs->spare_renderer_sandboxed();
+  content::RenderProcessHost::WarmupSpareRenderProcessHost(browser_context);
+  launching_spare_renderer_.reset();
+}
+
+void ElectronBrowserClient::DiscardSpareRenderer(
+    content::BrowserContext* browser_context) {
+  auto* spare = content::RenderProcessHost::FromID(spare_renderer_id_);
+  if (!spare || spare->GetBrowserContext() != browser_context)
+    return;
+  spare_renderer_id_ = content::ChildProcessHost::kInvalidUniqueID;
+  spare_renderer_switches_.clear();
+  // content drops its spare renderer once the process has exited.
+  spare->Shutdown(content::RESULT_CODE_KILLED);
+}
+
+void ElectronBrowserClient::ReplenishSpareRenderer(
+    base::WeakPtr<ElectronBrowserContext> browser_context) {
+  if (browser_context)
+    WarmupSpareRenderer(browser_context.get());
+}
+
+base::CommandLine::StringVector ElectronBrowserClient::GetRendererSwitches(
+    content::WebContents* web_contents) const {
+  auto* web_preferences = WebContentsPreferences::From(web_contents);
+  if (!web_preferences)
+    return {};
+  base::CommandLine command_line = CreateRendererSwitches();
+  web_preferences->AppendCommandLineSwitches(&command_line, false);
+  return command_line.argv();
+}
+
 void ElectronBrowserClient::AppendExtraCommandLineSwitches(
     base::CommandLine* command_line,
     int process_id) {
@@ -642,6 +698,17 @@ void ElectronBrowserClient::AppendExtraCommandLineSwitches(
       if (web_preferences)
         web_preferences->AppendCommandLineSwitches(
             command_line, IsRendererSubFrame(process_id));
+    } else if (launching_spare_renderer_) {
+      // The spare renderer has no WebContents yet, give it the switches of
+      // the session's spare renderer profile and remember them so it is only
+      // handed to WebContents that would have launched the same process.
+      WebContentsPreferences::AppendSandboxSwitches(command_line,
+                                                    *launching_spare_renderer_);
+      base::CommandLine spare_switches = CreateRendererSwitches();
+      WebContentsPreferences::AppendSandboxSwitches(&spare_switches,
+                                                    *launching_spare_renderer_);
+      spare_renderer_id_ = process_id;
+      spare_renderer_switches_ = spare_switches.argv();
     }
   }
 }
@@ -852,6 +919,48 @@ bool ElectronBrowserClient::ShouldUseProcessPerSite(
 #endif
 }
 
+bool ElectronBrowserClient::ShouldUseSpareRenderProcessHost(
+    content::BrowserContext* browser_context,
+    const GURL& site_url) {
+  // Only hand out the spare renderer we launched ourselves, and only to a
+  // WebContents whose preferences produce the same renderer command line.
+  if (spare_renderer_id_ == content::ChildProcessHost::kInvalidUniqueID)
+    return false;
+  auto* spare = content::RenderProcessHost::FromID(spare_renderer_id_);
+  if (!spare || spare->GetBrowserContext() != browser_context)
+    return false;
+  bool matches = false;
+  if (pending_web_contents_) {
+    matches =
+        GetRendererSwitches(pending_web_contents_) == spare_renderer_switches_;
+  } else if (pending_web_preferences_ &&
+             !WebContentsPreferences::HasCustomRendererSwitches(
+                 *pending_web_preferences_)) {
+    // The WebContents is still being created and has no
+    // WebContentsPreferences yet, check its raw preferences instead. The
+    // switches include the global sandbox ones, like those of the spare.
+    base::CommandLine switches = CreateRendererSwitches();
+    WebContentsPreferences::AppendSandboxSwitches(
+        &switches, WebContentsPreferences::IsSandboxed(
+                       browser_context, *pending_web_preferences_));
+    matches = switches.argv() == spare_renderer_switches_;
+  }
+  if (!matches)
+    return false;
+
+  // The spare renderer is being claimed, launch the next one once the new
+  // WebContents is no longer competing for the UI thread.
+  spare_renderer_id_ = content::ChildProcessHost::kInvalidUniqueID;
+  spare_renderer_switches_.clear();
+  base::PostTask(
+      FROM_HERE, {BrowserThread::UI, base::TaskPriority::BEST_EFFORT},
+      base::BindOnce(
+          &ElectronBrowserClient::ReplenishSpareRenderer,
+          weak_factory_.GetWeakPtr(),
+          static_cast<ElectronBrowserContext*>(browser_context)->GetWeakPtr()));
+  return true;
+}
+
 bool ElectronBrowserClient::ArePersistentMediaDeviceIDsAllowed(
     content::BrowserContext* browser_context,
     const GURL& scope,
@@ -972,6 +1081,10 @@ void ElectronBrowserClient::RenderProcessHostDestroyed(
   int process_id = host->GetID();
   pending_processes_.erase(process_id);
   renderer_is_subframe_.erase(process_id);
+  if (process_id == spare_renderer_id_) {
+    spare_renderer_id_ = content::ChildProcessHost::kInvalidUniqueID;
+    spare_renderer_switches_.clear();
+  }
   host->RemoveObserver(this);
 }
 
@@ -980,6 +1093,13 @@ void ElectronBrowserClient::RenderProcessReady(
   if (delegate_) {
     static_cast<api::App*>(delegate_)->RenderProcessReady(host);
   }
+  if (host->GetID() == spare_renderer_id_) {
+    auto* session = api::Session::FromBrowserContext(host->GetBrowserContext());
+    if (session) {
+      session->Emit("spare-renderer-ready",
+                    base::GetProcId(host->GetProcess().Handle()));
+    }
+  }
 }
 
 void ElectronBrowserClient::RenderProcessExited(
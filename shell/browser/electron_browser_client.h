@@ -11,11 +11,14 @@
 #include <string>
 #include <vector>
 
+#include "base/command_line.h"
 #include "base/files/file_path.h"
+#include "base/memory/weak_ptr.h"
 #include "base/synchronization/lock.h"
 #include "content/public/browser/content_browser_client.h"
 #include "content/public/browser/render_process_host_observer.h"
 #include "content/public/browser/web_contents.h"
+#include "content/public/common/child_process_host.h"
 #include "electron/buildflags/buildflags.h"
 #include "net/ssl/client_cert_identity.h"
 #include "services/metrics/public/cpp/ukm_source_id.h"
@@ -33,8 +36,13 @@ namespace net {
 class SSLCertRequestInfo;
 }
 
+namespace gin_helper {
+class Dictionary;
+}
+
 namespace electron {
 
+class ElectronBrowserContext;
 class ElectronBrowserMainParts;
 class NotificationPresenter;
 class PlatformNotificationService;
@@ -58,6 +66,21 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
   // Returns the WebContents for pending render processes.
   content::WebContents* GetWebContentsFromProcessID(int process_id);
 
+  // Launches a spare renderer process for |browser_context| according to the
+  // spare renderer profile of its session, see SessionPreferences.
+  void WarmupSpareRenderer(ElectronBrowserContext* browser_context);
+
+  // Shuts down the spare renderer launched for |browser_context|, if any, so
+  // it is no longer handed out.
+  void DiscardSpareRenderer(content::BrowserContext* browser_context);
+
+  // The preferences of the WebContents being created, its initial frame may
+  // claim the spare renderer when they match the spare renderer profile.
+  void set_pending_web_preferences(
+      const gin_helper::Dictionary* web_preferences) {
+    pending_web_preferences_ = web_preferences;
+  }
+
   NotificationPresenter* GetNotificationPresenter();
 
   void WebNotificationAllowed(content::RenderFrameHost* rfh,
@@ -281,6 +304,8 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
                       const GURL& site_url) override;
   bool ShouldUseProcessPerSite(content::BrowserContext* browser_context,
                                const GURL& effective_url) override;
+  bool ShouldUseSpareRenderProcessHost(content::BrowserContext* browser_context,
+                                       const GURL& site_url) override;
   bool ArePersistentMediaDeviceIDsAllowed(
       content::BrowserContext* browser_context,
       const GURL& scope,
@@ -303,11 +328,32 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
 
   bool IsRendererSubFrame(int process_id) const;
 
+  // Returns the process-level switches that |web_contents| would add to the
+  // command line of a freshly launched renderer.
+  base::CommandLine::StringVector GetRendererSwitches(
+      content::WebContents* web_contents) const;
+
+  void ReplenishSpareRenderer(base::WeakPtr<ElectronBrowserContext> context);
+
   // pending_render_process => web contents.
   std::map<int, content::WebContents*> pending_processes_;
 
   std::set<int> renderer_is_subframe_;
 
+  // The WebContents whose main frame navigation is currently picking a
+  // renderer process, see RegisterPendingSiteInstance.
+  content::WebContents* pending_web_contents_ = nullptr;
+  const gin_helper::Dictionary* pending_web_preferences_ = nullptr;
+
+  // Set while the spare renderer is being launched, tells whether it should
+  // be sandboxed.
+  absl::optional<bool> launching_spare_renderer_;
+
+  // The spare renderer we launched and the process-level switches it was
+  // launched with.
+  int spare_renderer_id_ = content::ChildProcessHost::kInvalidUniqueID;
+  base::CommandLine::StringVector spare_renderer_switches_;
+
   std::unique_ptr<PlatformNotificationService> notification_service_;
   std::unique_ptr<NotificationPresenter> notification_presenter_;
 
@@ -326,6 +372,8 @@ class ElectronBrowserClient : public content::ContentBrowserClient,
 #if BUILDFLAG(IS_MAC)
   ElectronBrowserMainParts* browser_main_parts_ = nullptr;
 #endif
+
+  base::WeakPtrFactory<ElectronBrowserClient> weak_factory_{this};
 };
 
 }  // namespace electron
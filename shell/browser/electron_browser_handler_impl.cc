@@ -58,6 +58,48 @@ void ElectronBrowserHandlerImpl::Invoke(bool internal,
   }
 }
 
+void ElectronBrowserHandlerImpl::RegisterChannel(uint32_t channel_id,
+                                                 const std::string& channel) {
+  if (channel_id != channels_.size() ||
+      channel_id >= mojom::ElectronBrowser::kMaxRegisteredChannels) {
+    receiver_.ReportBadMessage("Unexpected IPC channel ID");
+    return;
+  }
+  channels_.push_back(channel);
+}
+
+void ElectronBrowserHandlerImpl::MessageWithChannelId(
+    bool internal,
+    uint32_t channel_id,
+    blink::CloneableMessage arguments) {
+  // Copied, since a nested run loop in the handler may register channels or
+  // destroy |this|.
+  const std::string* channel = GetChannel(channel_id);
+  if (channel)
+    Message(internal, std::string(*channel), std::move(arguments));
+}
+
+void ElectronBrowserHandlerImpl::InvokeWithChannelId(
+    bool internal,
+    uint32_t channel_id,
+    blink::CloneableMessage arguments,
+    InvokeCallback callback) {
+  const std::string* channel = GetChannel(channel_id);
+  if (channel) {
+    Invoke(internal, std::string(*channel), std::move(arguments),
+           std::move(callback));
+  }
+}
+
+const std::string* ElectronBrowserHandlerImpl::GetChannel(
+    uint32_t channel_id) {
+  if (channel_id >= channels_.size()) {
+    receiver_.ReportBadMessage("Unknown IPC channel ID");
+    return nullptr;
+  }
+  return &channels_[channel_id];
+}
+
 void ElectronBrowserHandlerImpl::OnFirstNonEmptyLayout() {
   api::WebContents* api_web_contents = api::WebContents::From(web_contents());
   if (api_web_contents) {
@@ -95,6 +137,15 @@ void ElectronBrowserHandlerImpl::MessageTo(int32_t web_contents_id,
   }
 }
 
+void ElectronBrowserHandlerImpl::ConnectMessageTo(
+    int32_t web_contents_id,
+    mojo::PendingReceiver<mojom::ElectronMessageTarget> receiver) {
+  api::WebContents* api_web_contents = api::WebContents::From(web_contents());
+  if (api_web_contents) {
+    api_web_contents->ConnectMessageTo(web_contents_id, std::move(receiver));
+  }
+}
+
 void ElectronBrowserHandlerImpl::MessageHost(
     const std::string& channel,
     blink::CloneableMessage arguments) {
@@ -42,6 +42,15 @@ class ElectronBrowserHandlerImpl : public mojom::ElectronBrowser,
               const std::string& channel,
               blink::CloneableMessage arguments,
               InvokeCallback callback) override;
+  void RegisterChannel(uint32_t channel_id,
+                       const std::string& channel) override;
+  void MessageWithChannelId(bool internal,
+                            uint32_t channel_id,
+                            blink::CloneableMessage arguments) override;
+  void InvokeWithChannelId(bool internal,
+                           uint32_t channel_id,
+                           blink::CloneableMessage arguments,
+                           InvokeCallback callback) override;
   void OnFirstNonEmptyLayout() override;
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
@@ -52,6 +61,9 @@ class ElectronBrowserHandlerImpl : public mojom::ElectronBrowser,
   void MessageTo(int32_t web_contents_id,
                  const std::string& channel,
                  blink::CloneableMessage arguments) override;
+  void ConnectMessageTo(
+      int32_t web_contents_id,
+      mojo::PendingReceiver<mojom::ElectronMessageTarget> receiver) override;
   void MessageHost(const std::string& channel,
                    blink::CloneableMessage arguments) override;
   void UpdateDraggableRegions(
@@ -73,11 +85,19 @@ class ElectronBrowserHandlerImpl : public mojom::ElectronBrowser,
 
   content::RenderFrameHost* GetRenderFrameHost();
 
+  // Returns the channel registered for |channel_id|, or nullptr after
+  // reporting a bad message.
+  const std::string* GetChannel(uint32_t channel_id);
+
   const int render_process_id_;
   const int render_frame_id_;
 
   mojo::AssociatedReceiver<mojom::ElectronBrowser> receiver_{this};
 
+  // Channels registered by the renderer, indexed by their ID. Bounded by
+  // mojom::ElectronBrowser::kMaxRegisteredChannels.
+  std::vector<std::string> channels_;
+
   base::WeakPtrFactory<ElectronBrowserHandlerImpl> weak_factory_{this};
 };
 }  // namespace electron
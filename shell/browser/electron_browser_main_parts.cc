@@ -16,6 +16,7 @@
 #include "base/run_loop.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/trace_event/trace_event.h"
 #include "chrome/browser/icon_manager.h"
 #include "chrome/common/chrome_paths.h"
 #include "chrome/common/chrome_switches.h"
@@ -226,9 +227,17 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
   // set.  If this check is failing we may need to re-add that workaround
   DCHECK(base::ThreadTaskRunnerHandle::IsSet());
 
+  startup_timings_.bootstrap_started_time = base::Time::Now();
+  startup_timings_.bootstrap_started = base::TimeTicks::Now();
+
   // The ProxyResolverV8 has setup a complete V8 environment, in order to
   // avoid conflicts we only initialize our V8 environment after that.
-  js_env_ = std::make_unique<JavascriptEnvironment>(node_bindings_->uv_loop());
+  {
+    TRACE_EVENT0("electron", "ElectronBrowserMainParts::CreateJSEnvironment");
+    js_env_ =
+        std::make_unique<JavascriptEnvironment>(node_bindings_->uv_loop());
+  }
+  startup_timings_.js_environment_created = base::TimeTicks::Now();
 
   v8::HandleScope scope(js_env_->isolate());
 
@@ -237,6 +246,7 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
   node::Environment* env = node_bindings_->CreateEnvironment(
       js_env_->context(), js_env_->platform());
   node_env_ = std::make_unique<NodeEnvironment>(env);
+  startup_timings_.node_environment_created = base::TimeTicks::Now();
 
   env->set_trace_sync_io(env->options()->trace_sync_io);
 
@@ -248,6 +258,7 @@ void ElectronBrowserMainParts::PostEarlyInitialization() {
 
   // Load everything.
   node_bindings_->LoadEnvironment(env);
+  startup_timings_.node_environment_loaded = base::TimeTicks::Now();
 
   // Wrap the uv loop with global env.
   node_bindings_->set_uv_env(env);
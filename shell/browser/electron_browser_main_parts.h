@@ -9,6 +9,7 @@
 #include <string>
 
 #include "base/callback.h"
+#include "base/time/time.h"
 #include "base/timer/timer.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_main_parts.h"
@@ -80,6 +81,19 @@ class ElectronBrowserMainParts : public content::BrowserMainParts {
   ElectronBrowserMainParts(const ElectronBrowserMainParts&) = delete;
   ElectronBrowserMainParts& operator=(const ElectronBrowserMainParts&) = delete;
 
+  // Times at which each phase of the main process JS bootstrap finished,
+  // recorded in PostEarlyInitialization(). The phases are measured with
+  // TimeTicks so clock changes cannot reorder them; a phase that has not
+  // finished yet is null.
+  struct StartupTimings {
+    // Wall-clock time, to relate the bootstrap to other timestamps.
+    base::Time bootstrap_started_time;
+    base::TimeTicks bootstrap_started;
+    base::TimeTicks js_environment_created;
+    base::TimeTicks node_environment_created;
+    base::TimeTicks node_environment_loaded;
+  };
+
   static ElectronBrowserMainParts* Get();
 
   // Sets the exit code, will fail if the message loop is not ready.
@@ -101,6 +115,7 @@ class ElectronBrowserMainParts : public content::BrowserMainParts {
 
   Browser* browser() { return browser_.get(); }
   BrowserProcessImpl* browser_process() { return fake_browser_process_.get(); }
+  const StartupTimings& startup_timings() const { return startup_timings_; }
 
  protected:
   // content::BrowserMainParts:
@@ -159,6 +174,8 @@ class ElectronBrowserMainParts : public content::BrowserMainParts {
   // Before then, we just exit() without any intermediate steps.
   absl::optional<int> exit_code_;
 
+  StartupTimings startup_timings_;
+
   std::unique_ptr<JavascriptEnvironment> js_env_;
   std::unique_ptr<Browser> browser_;
   std::unique_ptr<NodeBindings> node_bindings_;
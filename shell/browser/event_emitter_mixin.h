@@ -34,6 +34,9 @@ class EventEmitterMixin {
     v8::Local<v8::Object> wrapper;
     if (!static_cast<T*>(this)->GetWrapper(isolate).ToLocal(&wrapper))
       return false;
+    // Skip creating the event and entering JS when nobody is listening.
+    if (!internal::HasListeners(isolate, wrapper, name))
+      return false;
     v8::Local<v8::Object> event = internal::CreateCustomEvent(isolate, wrapper);
     return EmitWithEvent(isolate, wrapper, name, event,
                          std::forward<Args>(args)...);
@@ -81,15 +84,9 @@ class EventEmitterMixin {
                             base::StringPiece name,
                             v8::Local<v8::Object> event,
                             Args&&... args) {
-    auto context = isolate->GetCurrentContext();
     gin_helper::EmitEvent(isolate, wrapper, name, event,
                           std::forward<Args>(args)...);
-    v8::Local<v8::Value> defaultPrevented;
-    if (event->Get(context, gin::StringToV8(isolate, "defaultPrevented"))
-            .ToLocal(&defaultPrevented)) {
-      return defaultPrevented->BooleanValue(isolate);
-    }
-    return false;
+    return internal::IsDefaultPrevented(isolate, event);
   }
 };
 
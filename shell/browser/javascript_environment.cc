@@ -4,17 +4,27 @@
 
 #include "shell/browser/javascript_environment.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_set>
 #include <utility>
 
+#include "base/allocator/buildflags.h"
 #include "base/allocator/partition_alloc_features.h"
 #include "base/allocator/partition_allocator/partition_alloc.h"
+#include "base/base_switches.h"
+#include "base/bind.h"
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/strings/string_piece.h"
+#include "base/synchronization/condition_variable.h"
+#include "base/synchronization/lock.h"
 #include "base/task/current_thread.h"
+#include "base/task/thread_pool.h"
 #include "base/task/thread_pool/initialization_util.h"
+#include "base/threading/thread_restrictions.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "base/trace_event/trace_event.h"
 #include "gin/array_buffer.h"
@@ -79,8 +89,15 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
   ArrayBufferAllocator() {
     // Ref.
     // https://source.chromium.org/chromium/chromium/src/+/master:third_party/blink/renderer/platform/wtf/allocator/partitions.cc;l=94;drc=062c315a858a87f834e16a144c2c8e9591af2beb
+    //
+    // Only one partition root per process can own the thread cache, and when
+    // PartitionAlloc is malloc that is the malloc root.
     allocator_->init({base::PartitionOptions::AlignedAlloc::kDisallowed,
+#if BUILDFLAG(USE_PARTITION_ALLOC_AS_MALLOC)
                       base::PartitionOptions::ThreadCache::kDisabled,
+#else
+                      base::PartitionOptions::ThreadCache::kEnabled,
+#endif
                       base::PartitionOptions::Quarantine::kAllowed,
                       base::PartitionOptions::Cookie::kAllowed,
                       base::PartitionOptions::BackupRefPtr::kDisabled,
@@ -101,13 +118,31 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
   }
 
   void Free(void* data, size_t size) override {
+    allocated_bytes_.fetch_sub(size, std::memory_order_relaxed);
     allocator_->root()->Free(data);
   }
 
+  static JavascriptEnvironment::ArrayBufferAllocatorInfo GetInfo() {
+    JavascriptEnvironment::ArrayBufferAllocatorInfo info;
+    info.allocated_bytes = allocated_bytes_.load(std::memory_order_relaxed);
+    info.allocation_count = allocation_count_.load(std::memory_order_relaxed);
+    info.total_allocated_bytes =
+        total_allocated_bytes_.load(std::memory_order_relaxed);
+    info.committed_bytes =
+        allocator_->root()->get_total_size_of_committed_pages();
+    return info;
+  }
+
  private:
   static void* AllocateMemoryOrNull(size_t size, InitializationPolicy policy) {
-    return AllocateMemoryWithFlags(size, policy,
-                                   base::PartitionAllocReturnNull);
+    void* data = AllocateMemoryWithFlags(size, policy,
+                                         base::PartitionAllocReturnNull);
+    if (data) {
+      allocated_bytes_.fetch_add(size, std::memory_order_relaxed);
+      allocation_count_.fetch_add(1, std::memory_order_relaxed);
+      total_allocated_bytes_.fetch_add(size, std::memory_order_relaxed);
+    }
+    return data;
   }
 
   static void* AllocateMemoryWithFlags(size_t size,
@@ -143,9 +178,17 @@ class ArrayBufferAllocator : public v8::ArrayBuffer::Allocator {
   }
 
   static base::NoDestructor<base::PartitionAllocator> allocator_;
+
+  // ArrayBuffers are allocated and freed from worker threads too.
+  static std::atomic<size_t> allocated_bytes_;
+  static std::atomic<uint64_t> allocation_count_;
+  static std::atomic<uint64_t> total_allocated_bytes_;
 };
 
 base::NoDestructor<base::PartitionAllocator> ArrayBufferAllocator::allocator_{};
+std::atomic<size_t> ArrayBufferAllocator::allocated_bytes_{0};
+std::atomic<uint64_t> ArrayBufferAllocator::allocation_count_{0};
+std::atomic<uint64_t> ArrayBufferAllocator::total_allocated_bytes_{0};
 
 JavascriptEnvironment::JavascriptEnvironment(uv_loop_t* event_loop)
     : isolate_(Initialize(event_loop)),
@@ -324,6 +367,146 @@ class TracingControllerImpl : public node::tracing::TracingController {
   }
 };
 
+namespace {
+
+// Whether worker tasks of V8 go to Chromium's ThreadPool once it is running,
+// so that V8's background GC and compilation jobs share the workers of the
+// browser process instead of competing with them.
+const base::Feature kV8WorkerTasksOnThreadPool{
+    "V8WorkerTasksOnThreadPool", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// The platform is created before the FeatureList is initialized, so look at
+// the command line directly.
+bool IsV8WorkerTasksOnThreadPoolEnabled() {
+  auto* cmd = base::CommandLine::ForCurrentProcess();
+  auto enabled_in = [&](const char* switch_name) {
+    for (base::StringPiece name : base::FeatureList::SplitFeatureListString(
+             cmd->GetSwitchValueASCII(switch_name))) {
+      if (name == kV8WorkerTasksOnThreadPool.name)
+        return true;
+    }
+    return false;
+  };
+  if (enabled_in(::switches::kDisableFeatures))
+    return false;
+  return enabled_in(::switches::kEnableFeatures);
+}
+
+// The use of the ForTesting flavor is a hack workaround to avoid having to
+// patch this as friend into the associated guard class.
+class WaitForTasksScopedAllowBaseSyncPrimitives
+    : public base::ScopedAllowBaseSyncPrimitivesForTesting {};
+
+// Node's platform with its immediate worker tasks moved to the ThreadPool
+// between StartUsingThreadPool and StopUsingThreadPool. Node keeps the same
+// number of worker threads for the tasks posted outside of that window and
+// for the delayed ones, so the reported NumberOfWorkerThreads is always real.
+class NodePlatformWithThreadPool : public node::NodePlatform {
+ public:
+  NodePlatformWithThreadPool(int worker_threads,
+                             v8::TracingController* tracing_controller,
+                             v8::PageAllocator* page_allocator)
+      : node::NodePlatform(worker_threads, tracing_controller, page_allocator),
+        tracker_(base::MakeRefCounted<TaskTracker>()) {}
+  ~NodePlatformWithThreadPool() override = default;
+
+  // disable copy
+  NodePlatformWithThreadPool(const NodePlatformWithThreadPool&) = delete;
+  NodePlatformWithThreadPool& operator=(const NodePlatformWithThreadPool&) =
+      delete;
+
+  void StartUsingThreadPool() { use_thread_pool_ = true; }
+
+  // Sends the tasks posted from now on to Node's workers and waits until the
+  // ones already posted to the ThreadPool have run, so that none of them runs
+  // against a torn down isolate. Only called for the main isolate at shutdown;
+  // DrainTasks is also called by Node for every worker_threads isolate and
+  // must leave the tasks of the other isolates alone.
+  void StopUsingThreadPool() {
+    use_thread_pool_ = false;
+    tracker_->WaitForAll();
+  }
+
+  // v8::Platform implementation.
+  void CallOnWorkerThread(std::unique_ptr<v8::Task> task) override {
+    if (!use_thread_pool_) {
+      node::NodePlatform::CallOnWorkerThread(std::move(task));
+      return;
+    }
+    PostTask({base::TaskPriority::USER_VISIBLE}, std::move(task));
+  }
+  void CallBlockingTaskOnWorkerThread(std::unique_ptr<v8::Task> task) override {
+    if (!use_thread_pool_) {
+      node::NodePlatform::CallOnWorkerThread(std::move(task));
+      return;
+    }
+    PostTask({base::TaskPriority::USER_BLOCKING}, std::move(task));
+  }
+  void CallLowPriorityTaskOnWorkerThread(
+      std::unique_ptr<v8::Task> task) override {
+    if (!use_thread_pool_) {
+      node::NodePlatform::CallOnWorkerThread(std::move(task));
+      return;
+    }
+    PostTask({base::TaskPriority::BEST_EFFORT}, std::move(task));
+  }
+
+ private:
+  // Counts the worker tasks posted to the ThreadPool that have not run yet.
+  class TaskTracker : public base::RefCountedThreadSafe<TaskTracker> {
+   public:
+    TaskTracker() : pending_cv_(&lock_) {}
+
+    // disable copy
+    TaskTracker(const TaskTracker&) = delete;
+    TaskTracker& operator=(const TaskTracker&) = delete;
+
+    void WillPostTask() {
+      base::AutoLock auto_lock(lock_);
+      pending_++;
+    }
+
+    void RunTask(std::unique_ptr<v8::Task> task) {
+      task->Run();
+      base::AutoLock auto_lock(lock_);
+      if (--pending_ == 0)
+        pending_cv_.Broadcast();
+    }
+
+    // Waits until every posted task has run; none of them is dropped.
+    void WaitForAll() {
+      WaitForTasksScopedAllowBaseSyncPrimitives allow_base_sync_primitives;
+      base::AutoLock auto_lock(lock_);
+      while (pending_ > 0)
+        pending_cv_.Wait();
+    }
+
+   private:
+    friend class base::RefCountedThreadSafe<TaskTracker>;
+    ~TaskTracker() = default;
+
+    base::Lock lock_;
+    base::ConditionVariable pending_cv_;
+    int pending_ = 0;
+  };
+
+  void PostTask(const base::TaskTraits& traits,
+                std::unique_ptr<v8::Task> task) {
+    tracker_->WillPostTask();
+    base::ThreadPool::PostTask(
+        FROM_HERE, traits,
+        base::BindOnce(&TaskTracker::RunTask, tracker_, std::move(task)));
+  }
+
+  scoped_refptr<TaskTracker> tracker_;
+  // V8 posts worker tasks from any thread.
+  std::atomic<bool> use_thread_pool_{false};
+};
+
+NodePlatformWithThreadPool* g_thread_pool_platform = nullptr;
+
+}  // namespace
+
 v8::Isolate* JavascriptEnvironment::Initialize(uv_loop_t* event_loop) {
   auto* cmd = base::CommandLine::ForCurrentProcess();
 
@@ -338,9 +521,17 @@ v8::Isolate* JavascriptEnvironment::Initialize(uv_loop_t* event_loop) {
   auto* tracing_agent = node::CreateAgent();
   auto* tracing_controller = new TracingControllerImpl();
   node::tracing::TraceEventHelper::SetAgent(tracing_agent);
-  platform_ = node::CreatePlatform(
-      base::RecommendedMaxNumberOfThreadsInThreadGroup(3, 8, 0.1, 0),
-      tracing_controller, gin::V8Platform::PageAllocator());
+  int worker_threads =
+      base::RecommendedMaxNumberOfThreadsInThreadGroup(3, 8, 0.1, 0);
+  if (IsV8WorkerTasksOnThreadPoolEnabled()) {
+    // Its worker tasks are moved to the ThreadPool in OnMessageLoopCreated.
+    g_thread_pool_platform = new NodePlatformWithThreadPool(
+        worker_threads, tracing_controller, gin::V8Platform::PageAllocator());
+    platform_ = g_thread_pool_platform;
+  } else {
+    platform_ = node::CreatePlatform(worker_threads, tracing_controller,
+                                     gin::V8Platform::PageAllocator());
+  }
 
   v8::V8::InitializePlatform(platform_);
   gin::IsolateHolder::Initialize(gin::IsolateHolder::kNonStrictMode,
@@ -355,6 +546,12 @@ v8::Isolate* JavascriptEnvironment::Initialize(uv_loop_t* event_loop) {
   return isolate;
 }
 
+// static
+JavascriptEnvironment::ArrayBufferAllocatorInfo
+JavascriptEnvironment::GetArrayBufferAllocatorInfo() {
+  return ArrayBufferAllocator::GetInfo();
+}
+
 // static
 v8::Isolate* JavascriptEnvironment::GetIsolate() {
   CHECK(g_isolate);
@@ -363,7 +560,11 @@ v8::Isolate* JavascriptEnvironment::GetIsolate() {
 
 void JavascriptEnvironment::OnMessageLoopCreated() {
   DCHECK(!microtasks_runner_);
-  microtasks_runner_ = std::make_unique<MicrotasksRunner>(isolate());
+  if (g_thread_pool_platform)
+    g_thread_pool_platform->StartUsingThreadPool();
+  v8::HandleScope scope(isolate_);
+  microtasks_runner_ = std::make_unique<MicrotasksRunner>(
+      isolate(), node::Environment::GetCurrent(context()));
   base::CurrentThread::Get()->AddTaskObserver(microtasks_runner_.get());
 }
 
@@ -375,6 +576,10 @@ void JavascriptEnvironment::OnMessageLoopDestroying() {
     gin_helper::CleanedUpAtExit::DoCleanup();
   }
   base::CurrentThread::Get()->RemoveTaskObserver(microtasks_runner_.get());
+  // The ThreadPool is shut down after the message loop, so this is the last
+  // point at which the main isolate's tasks on it can be waited for.
+  if (g_thread_pool_platform)
+    g_thread_pool_platform->StopUsingThreadPool();
 }
 
 NodeEnvironment::NodeEnvironment(node::Environment* env) : env_(env) {}
@@ -40,6 +40,19 @@ class JavascriptEnvironment {
 
   static v8::Isolate* GetIsolate();
 
+  // Statistics of the allocator backing ArrayBuffers and Buffers.
+  struct ArrayBufferAllocatorInfo {
+    // Bytes held by live ArrayBuffers.
+    size_t allocated_bytes = 0;
+    // Bytes of memory committed by the allocator.
+    size_t committed_bytes = 0;
+    // Total number of allocations since startup.
+    uint64_t allocation_count = 0;
+    // Total bytes allocated since startup, including freed ones.
+    uint64_t total_allocated_bytes = 0;
+  };
+  static ArrayBufferAllocatorInfo GetArrayBufferAllocatorInfo();
+
  private:
   v8::Isolate* Initialize(uv_loop_t* event_loop);
   // Leaked on exit.
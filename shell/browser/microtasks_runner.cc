@@ -5,14 +5,18 @@
 
 #include "shell/browser/microtasks_runner.h"
 
+#include "base/trace_event/trace_event.h"
 #include "shell/browser/electron_browser_main_parts.h"
 #include "shell/browser/javascript_environment.h"
 #include "shell/common/node_includes.h"
-#include "v8/include/v8.h"
 
 namespace electron {
 
-MicrotasksRunner::MicrotasksRunner(v8::Isolate* isolate) : isolate_(isolate) {}
+MicrotasksRunner::MicrotasksRunner(v8::Isolate* isolate,
+                                   node::Environment* env)
+    : isolate_(isolate), env_(env) {}
+
+MicrotasksRunner::~MicrotasksRunner() = default;
 
 void MicrotasksRunner::WillProcessTask(const base::PendingTask& pending_task,
                                        bool was_blocked_or_low_priority) {}
@@ -28,11 +32,43 @@ void MicrotasksRunner::DidProcessTask(const base::PendingTask& pending_task) {
   // contention for performing checkpoint between Node.js and chromium, ending
   // up Node.js dealying its callbacks. To fix this, now we always lets Node.js
   // handle the checkpoint in the browser process.
-  {
-    v8::HandleScope scope(isolate_);
-    node::CallbackScope microtasks_scope(isolate_, v8::Object::New(isolate_),
-                                         {0, 0});
+  //
+  // Most tasks on the UI thread never touch JS, so mirror what
+  // InternalCallbackScope::Close does and only pay for a node::CallbackScope
+  // when there are ticks to process. Checking for an empty microtask queue is
+  // cheap in V8.
+  if (!env_->can_call_into_js())
+    return;
+
+  // Inside a nested run loop entered from JS, e.g. a sync dialog opened by an
+  // ipcMain handler, InternalCallbackScope::Close leaves the microtasks to the
+  // outermost scope, so they must not run here either.
+  if (env_->async_callback_scope_depth() > 0)
+    return;
+
+  node::TickInfo* tick_info = env_->tick_info();
+  if (!tick_info->has_tick_scheduled()) {
+    TRACE_EVENT0("electron", "MicrotasksRunner::PerformMicrotaskCheckpoint");
+    isolate_->PerformMicrotaskCheckpoint();
   }
+
+  if (!tick_info->has_tick_scheduled() && !tick_info->has_rejection_to_warn()) {
+    ++skipped_callback_scopes_;
+    // Release the WeakRef targets kept alive during this task, as
+    // InternalCallbackScope::Close would.
+    env_->RunWeakRefCleanup();
+    return;
+  }
+
+  ++run_callback_scopes_;
+  TRACE_COUNTER2("electron", "MicrotasksRunner", "skipped",
+                 skipped_callback_scopes_, "run", run_callback_scopes_);
+  TRACE_EVENT0("electron", "MicrotasksRunner::RunTickCallback");
+  v8::HandleScope handle_scope(isolate_);
+  if (callback_resource_.IsEmpty())
+    callback_resource_.Reset(isolate_, v8::Object::New(isolate_));
+  node::CallbackScope microtasks_scope(
+      isolate_, callback_resource_.Get(isolate_), {0, 0});
 }
 
 }  // namespace electron
@@ -5,10 +5,13 @@
 #ifndef ELECTRON_SHELL_BROWSER_MICROTASKS_RUNNER_H_
 #define ELECTRON_SHELL_BROWSER_MICROTASKS_RUNNER_H_
 
+#include <cstdint>
+
 #include "base/task/task_observer.h"
+#include "v8/include/v8.h"
 
-namespace v8 {
-class Isolate;
+namespace node {
+class Environment;
 }
 
 namespace electron {
@@ -21,7 +24,8 @@ namespace electron {
 // microtasks.
 class MicrotasksRunner : public base::TaskObserver {
  public:
-  explicit MicrotasksRunner(v8::Isolate* isolate);
+  MicrotasksRunner(v8::Isolate* isolate, node::Environment* env);
+  ~MicrotasksRunner() override;
 
   // base::TaskObserver
   void WillProcessTask(const base::PendingTask& pending_task,
@@ -30,6 +34,16 @@ class MicrotasksRunner : public base::TaskObserver {
 
  private:
   v8::Isolate* isolate_;
+  node::Environment* env_;
+
+  // Resource object of the node::CallbackScope used to run the tick callback,
+  // created once instead of for every task.
+  v8::Global<v8::Object> callback_resource_;
+
+  // Number of tasks after which the node::CallbackScope was skipped or run,
+  // reported through the "electron" trace category.
+  uint64_t skipped_callback_scopes_ = 0;
+  uint64_t run_callback_scopes_ = 0;
 };
 
 }  // namespace electron
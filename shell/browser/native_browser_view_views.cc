@@ -34,13 +34,11 @@ void NativeBrowserViewViews::UpdateDraggableRegions(
   // y-value of each of the passed regions or it will be incorrectly
   // assumed that the regions begin in the top left corner as they
   // would for the main client window.
+  // Translating the resulting SkRegion is equivalent and saves cloning the
+  // regions on every update.
   auto const offset = GetBounds().OffsetFromOrigin();
-  auto snapped_regions = mojo::Clone(regions);
-  for (auto& snapped_region : snapped_regions) {
-    snapped_region->bounds.Offset(offset);
-  }
-
-  draggable_region_ = DraggableRegionsToSkRegion(snapped_regions);
+  draggable_region_ = DraggableRegionsToSkRegion(regions);
+  draggable_region_->translate(offset.x(), offset.y());
 }
 
 void NativeBrowserViewViews::SetAutoResizeProportions(
@@ -11,6 +11,7 @@
 #include "base/guid.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
+#include "base/trace_event/trace_event.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/storage_partition.h"
 #include "mojo/public/cpp/system/data_pipe_producer.h"
@@ -286,6 +287,8 @@ void ElectronURLLoaderFactory::CreateLoaderAndStart(
   mojo::PendingRemote<network::mojom::URLLoaderFactory> target_factory;
   this->Clone(target_factory.InitWithNewPipeAndPassReceiver());
 
+  TRACE_EVENT1("electron", "ElectronURLLoaderFactory::RunHandler", "scheme",
+               request.url.scheme());
   handler_.Run(
       request,
       base::BindOnce(&ElectronURLLoaderFactory::StartLoading, std::move(loader),
@@ -316,6 +319,8 @@ void ElectronURLLoaderFactory::StartLoading(
     mojo::PendingRemote<network::mojom::URLLoaderFactory> target_factory,
     ProtocolType type,
     gin::Arguments* args) {
+  TRACE_EVENT2("electron", "ElectronURLLoaderFactory::StartLoading", "scheme",
+               request.url.scheme(), "type", static_cast<int>(type));
   // Send network error when there is no argument passed.
   //
   // Note that we should not throw JS error in the callback no matter what is
@@ -507,6 +512,7 @@ void ElectronURLLoaderFactory::StartLoadingHttp(
   auto request = std::make_unique<network::ResourceRequest>();
   request->headers = original_request.headers;
   request->cors_exempt_headers = original_request.cors_exempt_headers;
+  request->priority = original_request.priority;
 
   dict.Get("url", &request->url);
   dict.Get("referrer", &request->referrer);
@@ -515,8 +521,16 @@ void ElectronURLLoaderFactory::StartLoadingHttp(
 
   base::DictionaryValue upload_data;
   if (request->method != net::HttpRequestHeaders::kGetMethod &&
-      request->method != net::HttpRequestHeaders::kHeadMethod)
-    dict.Get("uploadData", &upload_data);
+      request->method != net::HttpRequestHeaders::kHeadMethod &&
+      !dict.Get("uploadData", &upload_data)) {
+    // Forward the original body as-is when asked to, so data pipes and files
+    // are streamed by the NetworkService instead of being read into memory.
+    // It must be set before the SimpleURLLoader takes the request.
+    bool stream_upload_data = false;
+    if (dict.Get("streamUploadData", &stream_upload_data) &&
+        stream_upload_data)
+      request->request_body = original_request.request_body;
+  }
 
   ElectronBrowserContext* browser_context =
       ElectronBrowserContext::From("", false);
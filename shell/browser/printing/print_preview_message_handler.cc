@@ -8,10 +8,13 @@
 #include <utility>
 
 #include "base/bind.h"
+#include "base/files/file_util.h"
 #include "base/memory/read_only_shared_memory_region.h"
 #include "base/memory/ref_counted.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/task/post_task.h"
+#include "base/task/thread_pool.h"
+#include "base/trace_event/trace_event.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/printing/print_job_manager.h"
 #include "chrome/browser/printing/printer_query.h"
@@ -49,6 +52,13 @@ void StopWorker(int document_cookie) {
   }
 }
 
+bool WritePDF(const base::FilePath& path,
+              scoped_refptr<base::RefCountedMemory> data_bytes) {
+  TRACE_EVENT0("electron", "PrintPreviewMessageHandler::WritePDF");
+  return base::WriteFile(path, base::make_span(data_bytes->front(),
+                                               data_bytes->size()));
+}
+
 }  // namespace
 
 PrintPreviewMessageHandler::PrintPreviewMessageHandler(
@@ -155,6 +165,10 @@ void PrintPreviewMessageHandler::OnCompositePdfPageDone(
     printing::mojom::PrintCompositor::Status status,
     base::ReadOnlySharedMemoryRegion region) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
+  TRACE_EVENT_NESTABLE_ASYNC_END1(
+      "electron", "PrintPreviewMessageHandler::CompositePdfPage",
+      TRACE_ID_WITH_SCOPE("PrintToPDFPage", request_id, page_number),
+      "status", static_cast<int>(status));
   if (status != printing::mojom::PrintCompositor::Status::kSuccess) {
     LOG(ERROR) << "Compositing pdf failed on page: " << page_number
                << " with error: " << status;
@@ -173,6 +187,10 @@ void PrintPreviewMessageHandler::DidPreviewPage(
     return;
   }
 
+  TRACE_EVENT_INSTANT2("electron", "PrintPreviewMessageHandler::DidPreviewPage",
+                       TRACE_EVENT_SCOPE_THREAD, "request_id", request_id,
+                       "page_number", page_number);
+
   if (printing::IsOopifEnabled()) {
     auto* client =
         printing::PrintCompositeClient::FromWebContents(web_contents_);
@@ -183,6 +201,11 @@ void PrintPreviewMessageHandler::DidPreviewPage(
                     ? focused_frame
                     : web_contents_->GetMainFrame();
 
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN1(
+        "electron", "PrintPreviewMessageHandler::CompositePdfPage",
+        TRACE_ID_WITH_SCOPE("PrintToPDFPage", request_id, page_number),
+        "page_number", page_number);
+
     // Use utility process to convert skia metafile to pdf.
     client->DoCompositePageToPdf(
         params->document_cookie, rfh, content,
@@ -216,6 +239,16 @@ void PrintPreviewMessageHandler::PrintToPDF(
   options.GetInteger(printing::kPreviewRequestID, &request_id);
   promise_map_.emplace(request_id, std::move(promise));
 
+  // The renderer has no use for the output path.
+  absl::optional<base::Value> output_path = options.ExtractKey("outputPath");
+  if (output_path && output_path->is_string())
+    output_paths_[request_id] =
+        base::FilePath::FromUTF8Unsafe(output_path->GetString());
+
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1(
+      "electron", "PrintPreviewMessageHandler::PrintToPDF",
+      TRACE_ID_WITH_SCOPE("PrintToPDF", request_id), "request_id", request_id);
+
   auto* focused_frame = web_contents_->GetFocusedFrame();
   auto* rfh = focused_frame && focused_frame->HasSelection()
                   ? focused_frame
@@ -239,6 +272,10 @@ PrintPreviewMessageHandler::GetPromise(int request_id) {
   gin_helper::Promise<v8::Local<v8::Value>> promise = std::move(it->second);
   promise_map_.erase(it);
 
+  TRACE_EVENT_NESTABLE_ASYNC_END0(
+      "electron", "PrintPreviewMessageHandler::PrintToPDF",
+      TRACE_ID_WITH_SCOPE("PrintToPDF", request_id));
+
   return promise;
 }
 
@@ -247,6 +284,19 @@ void PrintPreviewMessageHandler::ResolvePromise(
     scoped_refptr<base::RefCountedMemory> data_bytes) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
+  auto output_path = output_paths_.find(request_id);
+  if (output_path != output_paths_.end()) {
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE,
+        {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+         base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+        base::BindOnce(&WritePDF, output_path->second, std::move(data_bytes)),
+        base::BindOnce(&PrintPreviewMessageHandler::OnPDFWritten,
+                       weak_ptr_factory_.GetWeakPtr(), request_id));
+    output_paths_.erase(output_path);
+    return;
+  }
+
   gin_helper::Promise<v8::Local<v8::Value>> promise = GetPromise(request_id);
 
   v8::Isolate* isolate = promise.isolate();
@@ -267,10 +317,29 @@ void PrintPreviewMessageHandler::ResolvePromise(
 void PrintPreviewMessageHandler::RejectPromise(int request_id) {
   DCHECK_CURRENTLY_ON(BrowserThread::UI);
 
+  output_paths_.erase(request_id);
   gin_helper::Promise<v8::Local<v8::Value>> promise = GetPromise(request_id);
   promise.RejectWithErrorMessage("Failed to generate PDF");
 }
 
+void PrintPreviewMessageHandler::OnPDFWritten(int request_id, bool success) {
+  DCHECK_CURRENTLY_ON(BrowserThread::UI);
+
+  gin_helper::Promise<v8::Local<v8::Value>> promise = GetPromise(request_id);
+  if (!success) {
+    promise.RejectWithErrorMessage("Failed to write PDF to file");
+    return;
+  }
+
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(
+      v8::Local<v8::Context>::New(isolate, promise.GetContext()));
+
+  promise.Resolve(node::Buffer::New(isolate, 0).ToLocalChecked());
+}
+
 WEB_CONTENTS_USER_DATA_KEY_IMPL(PrintPreviewMessageHandler);
 
 }  // namespace electron
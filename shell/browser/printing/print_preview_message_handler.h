@@ -7,6 +7,7 @@
 
 #include <map>
 
+#include "base/files/file_path.h"
 #include "base/memory/ref_counted_memory.h"
 #include "base/memory/weak_ptr.h"
 #include "components/printing/common/print.mojom.h"
@@ -86,10 +87,15 @@ class PrintPreviewMessageHandler
   void ResolvePromise(int request_id,
                       scoped_refptr<base::RefCountedMemory> data_bytes);
   void RejectPromise(int request_id);
+  void OnPDFWritten(int request_id, bool success);
 
   using PromiseMap = std::map<int, gin_helper::Promise<v8::Local<v8::Value>>>;
   PromiseMap promise_map_;
 
+  // The files to write the PDF of a request to, instead of resolving its
+  // promise with the data.
+  std::map<int, base::FilePath> output_paths_;
+
   // TODO(clavin): refactor to use the WebContents provided by the
   // WebContentsUserData base class instead of storing a duplicate ref
   content::WebContents* web_contents_ = nullptr;
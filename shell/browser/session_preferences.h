@@ -9,6 +9,7 @@
 
 #include "base/files/file_path.h"
 #include "base/supports_user_data.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace content {
 class BrowserContext;
@@ -31,11 +32,21 @@ class SessionPreferences : public base::SupportsUserData::Data {
   }
   const std::vector<base::FilePath>& preloads() const { return preloads_; }
 
+  // When set, a spare renderer process is kept warm for this session, and
+  // the value tells whether it is launched sandboxed.
+  void set_spare_renderer_sandboxed(absl::optional<bool> sandboxed) {
+    spare_renderer_sandboxed_ = sandboxed;
+  }
+  absl::optional<bool> spare_renderer_sandboxed() const {
+    return spare_renderer_sandboxed_;
+  }
+
  private:
   // The user data key.
   static int kLocatorKey;
 
   std::vector<base::FilePath> preloads_;
+  absl::optional<bool> spare_renderer_sandboxed_;
 };
 
 }  // namespace electron
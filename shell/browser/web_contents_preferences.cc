@@ -94,6 +94,39 @@ std::vector<WebContentsPreferences*>& Instances() {
   static base::NoDestructor<std::vector<WebContentsPreferences*>> g_instances;
   return *g_instances;
 }
+
+bool IsSandboxedByDefault(content::BrowserContext* browser_context,
+                          bool node_integration,
+                          bool node_integration_in_worker,
+                          bool has_preload) {
+  bool sandbox_disabled_by_default =
+      node_integration || node_integration_in_worker || has_preload ||
+      !SessionPreferences::GetValidPreloads(browser_context).empty();
+  return !sandbox_disabled_by_default;
+}
+
+// Returns the preload script of |web_preferences|, or sets |error| when it is
+// invalid.
+absl::optional<base::FilePath> GetPreloadPathFromDictionary(
+    const gin_helper::Dictionary& web_preferences,
+    std::string* error) {
+  base::FilePath::StringType preload_path;
+  std::string preload_url_str;
+  if (web_preferences.Get(options::kPreloadScript, &preload_path)) {
+    base::FilePath preload(preload_path);
+    if (preload.IsAbsolute())
+      return preload;
+    *error = "preload script must have absolute path.";
+  } else if (web_preferences.Get(options::kPreloadURL, &preload_url_str)) {
+    // Translate to file path if there is "preload-url" option.
+    base::FilePath preload;
+    GURL preload_url(preload_url_str);
+    if (net::FileURLToFilePath(preload_url, &preload))
+      return preload;
+    *error = "preload url must be file:// protocol.";
+  }
+  return absl::nullopt;
+}
 }  // namespace
 
 WebContentsPreferences::WebContentsPreferences(
@@ -129,6 +162,7 @@ void WebContentsPreferences::Clear() {
   node_integration_ = false;
   node_integration_in_sub_frames_ = false;
   node_integration_in_worker_ = false;
+  direct_send_to_ = false;
   disable_html_fullscreen_window_resize_ = false;
   webview_tag_ = false;
   sandbox_ = absl::nullopt;
@@ -188,6 +222,7 @@ void WebContentsPreferences::Merge(
                       &node_integration_in_sub_frames_);
   web_preferences.Get(options::kNodeIntegrationInWorker,
                       &node_integration_in_worker_);
+  web_preferences.Get(options::kDirectSendTo, &direct_send_to_);
   web_preferences.Get(options::kDisableHtmlFullscreenWindowResize,
                       &disable_html_fullscreen_window_resize_);
   web_preferences.Get(options::kWebviewTag, &webview_tag_);
@@ -249,25 +284,12 @@ void WebContentsPreferences::Merge(
                           &disable_blink_features))
     disable_blink_features_ = disable_blink_features;
 
-  base::FilePath::StringType preload_path;
-  std::string preload_url_str;
-  if (web_preferences.Get(options::kPreloadScript, &preload_path)) {
-    base::FilePath preload(preload_path);
-    if (preload.IsAbsolute()) {
-      preload_path_ = preload;
-    } else {
-      LOG(ERROR) << "preload script must have absolute path.";
-    }
-  } else if (web_preferences.Get(options::kPreloadURL, &preload_url_str)) {
-    // Translate to file path if there is "preload-url" option.
-    base::FilePath preload;
-    GURL preload_url(preload_url_str);
-    if (net::FileURLToFilePath(preload_url, &preload)) {
-      preload_path_ = preload;
-    } else {
-      LOG(ERROR) << "preload url must be file:// protocol.";
-    }
-  }
+  std::string preload_error;
+  if (auto preload = GetPreloadPathFromDictionary(web_preferences,
+                                                  &preload_error))
+    preload_path_ = preload;
+  else if (!preload_error.empty())
+    LOG(ERROR) << preload_error;
 
   std::string type;
   if (web_preferences.Get(options::kType, &type)) {
@@ -324,11 +346,66 @@ bool WebContentsPreferences::GetPreloadPath(base::FilePath* path) const {
 bool WebContentsPreferences::IsSandboxed() const {
   if (sandbox_)
     return *sandbox_;
-  bool sandbox_disabled_by_default =
-      node_integration_ || node_integration_in_worker_ || preload_path_ ||
-      !SessionPreferences::GetValidPreloads(web_contents_->GetBrowserContext())
-           .empty();
-  return !sandbox_disabled_by_default;
+  return IsSandboxedByDefault(web_contents_->GetBrowserContext(),
+                              node_integration_, node_integration_in_worker_,
+                              preload_path_.has_value());
+}
+
+// static
+bool WebContentsPreferences::IsSandboxed(
+    content::BrowserContext* browser_context,
+    const gin_helper::Dictionary& web_preferences) {
+  bool sandbox;
+  if (web_preferences.Get(options::kSandbox, &sandbox))
+    return sandbox;
+  // Resolve the preload the same way as Merge, an invalid one is ignored.
+  bool node_integration = false;
+  bool node_integration_in_worker = false;
+  std::string preload_error;
+  web_preferences.Get(options::kNodeIntegration, &node_integration);
+  web_preferences.Get(options::kNodeIntegrationInWorker,
+                      &node_integration_in_worker);
+  bool has_preload =
+      GetPreloadPathFromDictionary(web_preferences, &preload_error)
+          .has_value();
+  return IsSandboxedByDefault(browser_context, node_integration,
+                              node_integration_in_worker, has_preload);
+}
+
+// static
+bool WebContentsPreferences::HasCustomRendererSwitches(
+    const gin_helper::Dictionary& web_preferences) {
+  // Keep in sync with AppendCommandLineSwitches.
+  bool enabled = false;
+  if ((web_preferences.Get(options::kExperimentalFeatures, &enabled) &&
+       enabled) ||
+      (web_preferences.Get(options::kNodeIntegrationInWorker, &enabled) &&
+       enabled) ||
+      (web_preferences.Get(options::kDirectSendTo, &enabled) && enabled))
+    return true;
+#if BUILDFLAG(IS_MAC)
+  if (web_preferences.Get(options::kScrollBounce, &enabled) && enabled)
+    return true;
+#endif
+  std::vector<std::string> args;
+  if ((web_preferences.Get(options::kCustomArgs, &args) && !args.empty()) ||
+      (web_preferences.Get("commandLineSwitches", &args) && !args.empty()))
+    return true;
+  std::string features;
+  return web_preferences.Get(options::kEnableBlinkFeatures, &features) ||
+         web_preferences.Get(options::kDisableBlinkFeatures, &features);
+}
+
+// static
+void WebContentsPreferences::AppendSandboxSwitches(
+    base::CommandLine* command_line,
+    bool sandboxed) {
+  if (sandboxed) {
+    command_line->AppendSwitch(switches::kEnableSandbox);
+  } else if (!command_line->HasSwitch(switches::kEnableSandbox)) {
+    command_line->AppendSwitch(sandbox::policy::switches::kNoSandbox);
+    command_line->AppendSwitch(::switches::kNoZygote);
+  }
 }
 
 // static
@@ -362,12 +439,7 @@ void WebContentsPreferences::AppendCommandLineSwitches(
   // unless nodeIntegrationInSubFrames is enabled
   bool can_sandbox_frame = is_subframe && !node_integration_in_sub_frames_;
 
-  if (IsSandboxed() || can_sandbox_frame) {
-    command_line->AppendSwitch(switches::kEnableSandbox);
-  } else if (!command_line->HasSwitch(switches::kEnableSandbox)) {
-    command_line->AppendSwitch(sandbox::policy::switches::kNoSandbox);
-    command_line->AppendSwitch(::switches::kNoZygote);
-  }
+  AppendSandboxSwitches(command_line, IsSandboxed() || can_sandbox_frame);
 
 #if BUILDFLAG(IS_MAC)
   // Enable scroll bounce.
@@ -395,6 +467,9 @@ void WebContentsPreferences::AppendCommandLineSwitches(
   if (node_integration_in_worker_)
     command_line->AppendSwitch(switches::kNodeIntegrationInWorker);
 
+  if (direct_send_to_)
+    command_line->AppendSwitch(switches::kDirectSendTo);
+
   // We are appending args to a webContents so let's save the current state
   // of our preferences object so that during the lifetime of the WebContents
   // we can fetch the options used to initally configure the WebContents
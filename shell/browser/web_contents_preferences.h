@@ -79,6 +79,20 @@ class WebContentsPreferences
   bool GetPreloadPath(base::FilePath* path) const;
   bool IsSandboxed() const;
 
+  // Whether a WebContents created with |web_preferences| in |browser_context|
+  // would get a sandboxed renderer.
+  static bool IsSandboxed(content::BrowserContext* browser_context,
+                          const gin_helper::Dictionary& web_preferences);
+
+  // Whether |web_preferences| adds renderer switches other than the sandbox
+  // ones.
+  static bool HasCustomRendererSwitches(
+      const gin_helper::Dictionary& web_preferences);
+
+  // Append the switches that turn the renderer sandbox on or off.
+  static void AppendSandboxSwitches(base::CommandLine* command_line,
+                                    bool sandboxed);
+
  private:
   friend class content::WebContentsUserData<WebContentsPreferences>;
   friend class ElectronBrowserClient;
@@ -98,6 +112,7 @@ class WebContentsPreferences
   bool node_integration_;
   bool node_integration_in_sub_frames_;
   bool node_integration_in_worker_;
+  bool direct_send_to_;
   bool disable_html_fullscreen_window_resize_;
   bool webview_tag_;
   absl::optional<bool> sandbox_;
@@ -4,6 +4,7 @@
 
 #include "shell/common/api/electron_api_native_image.h"
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -11,9 +12,12 @@
 
 #include "base/files/file_util.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/strings/pattern.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "base/threading/thread_restrictions.h"
 #include "gin/arguments.h"
 #include "gin/object_template_builder.h"
@@ -21,6 +25,7 @@
 #include "gin/wrappable.h"
 #include "net/base/data_url.h"
 #include "shell/common/asar/asar_util.h"
+#include "shell/common/decoded_image_cache.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_converters/gfx_converter.h"
 #include "shell/common/gin_converters/gurl_converter.h"
@@ -28,8 +33,10 @@
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
 #include "shell/common/gin_helper/object_template_builder.h"
+#include "shell/common/gin_helper/promise.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/skia_util.h"
+#include "skia/ext/image_operations.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/skia/include/core/SkImageInfo.h"
 #include "third_party/skia/include/core/SkPixelRef.h"
@@ -78,6 +85,167 @@ base::FilePath NormalizePath(const base::FilePath& path) {
   }
 }
 
+// Computes the size and method of a resize from the |options| passed to
+// resize(), returns false if the result would be an empty image.
+bool GetResizeParameters(const gfx::Size& current_size,
+                         const base::DictionaryValue& options,
+                         gfx::Size* size,
+                         skia::ImageOperations::ResizeMethod* method) {
+  int width = current_size.width();
+  int height = current_size.height();
+  bool width_set = options.GetInteger("width", &width);
+  bool height_set = options.GetInteger("height", &height);
+  size->SetSize(width, height);
+
+  float aspect_ratio = 1.f;
+  if (!current_size.IsEmpty())
+    aspect_ratio = static_cast<float>(current_size.width()) /
+                   static_cast<float>(current_size.height());
+
+  if (width <= 0 && height <= 0) {
+    return false;
+  } else if (width_set && !height_set) {
+    // Scale height to preserve original aspect ratio
+    size->set_height(width);
+    *size = gfx::ScaleToRoundedSize(*size, 1.f, 1.f / aspect_ratio);
+  } else if (height_set && !width_set) {
+    // Scale width to preserve original aspect ratio
+    size->set_width(height);
+    *size = gfx::ScaleToRoundedSize(*size, aspect_ratio, 1.f);
+  }
+
+  *method = skia::ImageOperations::ResizeMethod::RESIZE_BEST;
+  std::string quality;
+  options.GetString("quality", &quality);
+  if (quality == "good")
+    *method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
+  else if (quality == "better")
+    *method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
+  return true;
+}
+
+// Creates a Buffer that takes over |encoded| instead of copying it.
+void FreeEncodedData(char* data, void* hint) {
+  delete static_cast<std::vector<unsigned char>*>(hint);
+}
+
+v8::Local<v8::Value> AdoptEncodedData(v8::Isolate* isolate,
+                                      std::vector<unsigned char> encoded) {
+  if (encoded.empty())
+    return node::Buffer::New(isolate, 0).ToLocalChecked();
+  auto* data = new std::vector<unsigned char>(std::move(encoded));
+  return node::Buffer::New(isolate, reinterpret_cast<char*>(data->data()),
+                           data->size(), &FreeEncodedData, data)
+      .ToLocalChecked();
+}
+
+// The async image APIs share a few sequences so a burst of requests can not
+// occupy the whole thread pool.
+constexpr size_t kImageTaskRunnerCount = 4;
+
+scoped_refptr<base::SequencedTaskRunner> GetImageTaskRunner() {
+  using TaskRunners = std::vector<scoped_refptr<base::SequencedTaskRunner>>;
+  static base::NoDestructor<TaskRunners> task_runners([] {
+    TaskRunners runners;
+    for (size_t i = 0; i < kImageTaskRunnerCount; ++i)
+      runners.push_back(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE}));
+    return runners;
+  }());
+  static std::atomic<size_t> next_task_runner{0};
+  return (*task_runners)[next_task_runner++ % kImageTaskRunnerCount];
+}
+
+// Runs |task| on the thread pool and |reply| with its result on the current
+// sequence. Threads without a task runner, like Node.js workers, run both
+// synchronously instead.
+template <typename T>
+void PostImageTask(base::OnceCallback<T()> task,
+                   base::OnceCallback<void(T)> reply) {
+  if (!base::SequencedTaskRunnerHandle::IsSet()) {
+    std::move(reply).Run(std::move(task).Run());
+    return;
+  }
+  GetImageTaskRunner()->PostTaskAndReplyWithResult(FROM_HERE, std::move(task),
+                                                   std::move(reply));
+}
+
+std::vector<unsigned char> EncodePNG(const SkBitmap& bitmap) {
+  std::vector<unsigned char> encoded;
+  gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, &encoded);
+  return encoded;
+}
+
+std::vector<unsigned char> EncodeJPEG(const SkBitmap& bitmap, int quality) {
+  std::vector<unsigned char> encoded;
+  if (!gfx::JPEGCodec::Encode(bitmap, quality, &encoded))
+    encoded.clear();
+  return encoded;
+}
+
+v8::Local<v8::Value> CopyBitmap(v8::Isolate* isolate, const SkBitmap& bitmap) {
+  SkImageInfo info =
+      SkImageInfo::MakeN32Premul(bitmap.width(), bitmap.height());
+
+  auto array_buffer = v8::ArrayBuffer::New(isolate, info.computeMinByteSize());
+  auto backing_store = array_buffer->GetBackingStore();
+  if (bitmap.readPixels(info, backing_store->Data(), info.minRowBytes(), 0,
+                        0)) {
+    return node::Buffer::New(isolate, array_buffer, 0,
+                             info.computeMinByteSize())
+        .ToLocalChecked();
+  }
+  return node::Buffer::New(isolate, 0).ToLocalChecked();
+}
+
+gfx::ImageSkia::ImageSkiaReps DecodeFromPath(const base::FilePath& path) {
+  return DecodedImageCache::GetInstance()
+      ->GetImage(NormalizePath(path))
+      .image_reps();
+}
+
+gfx::ImageSkia::ImageSkiaReps DecodeFromBuffer(const std::string& data,
+                                               int width,
+                                               int height,
+                                               double scale_factor) {
+  gfx::ImageSkia image_skia;
+  electron::util::AddImageSkiaRepFromBuffer(
+      &image_skia, reinterpret_cast<const unsigned char*>(data.data()),
+      data.size(), width, height, scale_factor);
+  return image_skia.image_reps();
+}
+
+gfx::ImageSkia::ImageSkiaReps ResizeReps(
+    const gfx::ImageSkia::ImageSkiaReps& reps,
+    const gfx::Size& size,
+    skia::ImageOperations::ResizeMethod method) {
+  gfx::ImageSkia::ImageSkiaReps resized;
+  for (const auto& rep : reps) {
+    gfx::Size pixel_size = gfx::ScaleToCeiledSize(size, rep.scale());
+    resized.emplace_back(
+        skia::ImageOperations::Resize(rep.GetBitmap(), method,
+                                      pixel_size.width(), pixel_size.height()),
+        rep.scale());
+  }
+  return resized;
+}
+
+gfx::Image ImageFromReps(const gfx::ImageSkia::ImageSkiaReps& reps) {
+  gfx::ImageSkia image_skia;
+  for (const auto& rep : reps)
+    image_skia.AddRepresentation(rep);
+  return gfx::Image(image_skia);
+}
+
+void ResolveWithEncodedData(gin_helper::Promise<v8::Local<v8::Value>> promise,
+                            std::vector<unsigned char> encoded) {
+  v8::Isolate* isolate = promise.isolate();
+  gin_helper::Locker locker(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Context::Scope context_scope(promise.GetContext());
+  promise.Resolve(AdoptEncodedData(isolate, std::move(encoded)));
+}
+
 #if BUILDFLAG(IS_MAC)
 bool IsTemplateFilename(const base::FilePath& path) {
   return (base::MatchPattern(path.value(), "*Template.*") ||
@@ -213,43 +381,59 @@ v8::Local<v8::Value> NativeImage::ToPNG(gin::Arguments* args) {
 
   const SkBitmap bitmap =
       image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
-  std::vector<unsigned char> encoded;
-  gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false, &encoded);
-  const char* data = reinterpret_cast<char*>(encoded.data());
-  size_t size = encoded.size();
-  return node::Buffer::Copy(args->isolate(), data, size).ToLocalChecked();
+  return AdoptEncodedData(args->isolate(), EncodePNG(bitmap));
 }
 
-v8::Local<v8::Value> NativeImage::ToBitmap(gin::Arguments* args) {
+v8::Local<v8::Promise> NativeImage::ToPNGAsync(gin::Arguments* args) {
   float scale_factor = GetScaleFactorFromOptions(args);
+  gin_helper::Promise<v8::Local<v8::Value>> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  // Use raw 1x PNG bytes when they already exist, As1xPNGBytes would encode
+  // on this thread otherwise.
+  if (scale_factor == 1.0f &&
+      image_.HasRepresentation(gfx::Image::kImageRepPNG)) {
+    scoped_refptr<base::RefCountedMemory> png = image_.As1xPNGBytes();
+    promise.Resolve(node::Buffer::Copy(args->isolate(),
+                                       png->front_as<char>(), png->size())
+                        .ToLocalChecked());
+    return handle;
+  }
 
   const SkBitmap bitmap =
       image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+  PostImageTask(base::BindOnce(&EncodePNG, bitmap),
+                base::BindOnce(&ResolveWithEncodedData, std::move(promise)));
+  return handle;
+}
 
-  SkImageInfo info =
-      SkImageInfo::MakeN32Premul(bitmap.width(), bitmap.height());
+v8::Local<v8::Value> NativeImage::ToBitmap(gin::Arguments* args) {
+  float scale_factor = GetScaleFactorFromOptions(args);
 
-  auto array_buffer =
-      v8::ArrayBuffer::New(args->isolate(), info.computeMinByteSize());
-  auto backing_store = array_buffer->GetBackingStore();
-  if (bitmap.readPixels(info, backing_store->Data(), info.minRowBytes(), 0,
-                        0)) {
-    return node::Buffer::New(args->isolate(), array_buffer, 0,
-                             info.computeMinByteSize())
-        .ToLocalChecked();
-  }
-  return node::Buffer::New(args->isolate(), 0).ToLocalChecked();
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+  return CopyBitmap(args->isolate(), bitmap);
 }
 
 v8::Local<v8::Value> NativeImage::ToJPEG(v8::Isolate* isolate, int quality) {
   std::vector<unsigned char> output;
   gfx::JPEG1xEncodedDataFromImage(image_, quality, &output);
-  if (output.empty())
-    return node::Buffer::New(isolate, 0).ToLocalChecked();
-  return node::Buffer::Copy(isolate,
-                            reinterpret_cast<const char*>(&output.front()),
-                            output.size())
-      .ToLocalChecked();
+  return AdoptEncodedData(isolate, std::move(output));
+}
+
+v8::Local<v8::Promise> NativeImage::ToJPEGAsync(v8::Isolate* isolate,
+                                                int quality) {
+  gin_helper::Promise<v8::Local<v8::Value>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  // Like JPEG1xEncodedDataFromImage, only a 1x representation is encoded.
+  const gfx::ImageSkiaRep rep = image_.AsImageSkia().GetRepresentation(1.0f);
+  if (rep.scale() != 1.0f) {
+    ResolveWithEncodedData(std::move(promise), {});
+    return handle;
+  }
+  PostImageTask(base::BindOnce(&EncodeJPEG, rep.GetBitmap(), quality),
+                base::BindOnce(&ResolveWithEncodedData, std::move(promise)));
+  return handle;
 }
 
 std::string NativeImage::ToDataURL(gin::Arguments* args) {
@@ -266,6 +450,27 @@ std::string NativeImage::ToDataURL(gin::Arguments* args) {
       image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap());
 }
 
+v8::Local<v8::Promise> NativeImage::ToDataURLAsync(gin::Arguments* args) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+  gin_helper::Promise<std::string> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  if (scale_factor == 1.0f &&
+      image_.HasRepresentation(gfx::Image::kImageRepPNG)) {
+    scoped_refptr<base::RefCountedMemory> png = image_.As1xPNGBytes();
+    promise.Resolve(webui::GetPngDataUrl(png->front(), png->size()));
+    return handle;
+  }
+
+  const SkBitmap bitmap =
+      image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+  PostImageTask(
+      base::BindOnce(&webui::GetBitmapDataUrl, bitmap),
+      base::BindOnce(&gin_helper::Promise<std::string>::ResolvePromise,
+                     std::move(promise)));
+  return handle;
+}
+
 void SkUnref(char* data, void* hint) {
   reinterpret_cast<SkRefCnt*>(hint)->unref();
 }
@@ -275,6 +480,10 @@ v8::Local<v8::Value> NativeImage::GetBitmap(gin::Arguments* args) {
 
   const SkBitmap bitmap =
       image_.AsImageSkia().GetRepresentation(scale_factor).GetBitmap();
+  // Immutable pixels are shared with other images, like those of the images
+  // loaded from the same path, so they must not be handed out for writing.
+  if (bitmap.isImmutable())
+    return CopyBitmap(args->isolate(), bitmap);
   SkPixelRef* ref = bitmap.pixelRef();
   if (!ref)
     return node::Buffer::New(args->isolate(), 0).ToLocalChecked();
@@ -334,34 +543,10 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
                                              base::DictionaryValue options) {
   float scale_factor = GetScaleFactorFromOptions(args);
 
-  gfx::Size size = GetSize(scale_factor);
-  int width = size.width();
-  int height = size.height();
-  bool width_set = options.GetInteger("width", &width);
-  bool height_set = options.GetInteger("height", &height);
-  size.SetSize(width, height);
-
-  if (width <= 0 && height <= 0) {
+  gfx::Size size;
+  skia::ImageOperations::ResizeMethod method;
+  if (!GetResizeParameters(GetSize(scale_factor), options, &size, &method))
     return CreateEmpty(args->isolate());
-  } else if (width_set && !height_set) {
-    // Scale height to preserve original aspect ratio
-    size.set_height(width);
-    size =
-        gfx::ScaleToRoundedSize(size, 1.f, 1.f / GetAspectRatio(scale_factor));
-  } else if (height_set && !width_set) {
-    // Scale width to preserve original aspect ratio
-    size.set_width(height);
-    size = gfx::ScaleToRoundedSize(size, GetAspectRatio(scale_factor), 1.f);
-  }
-
-  skia::ImageOperations::ResizeMethod method =
-      skia::ImageOperations::ResizeMethod::RESIZE_BEST;
-  std::string quality;
-  options.GetString("quality", &quality);
-  if (quality == "good")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_GOOD;
-  else if (quality == "better")
-    method = skia::ImageOperations::ResizeMethod::RESIZE_BETTER;
 
   gfx::ImageSkia resized = gfx::ImageSkiaOperations::CreateResizedImage(
       image_.AsImageSkia(), method, size);
@@ -369,6 +554,33 @@ gin::Handle<NativeImage> NativeImage::Resize(gin::Arguments* args,
       args->isolate(), new NativeImage(args->isolate(), gfx::Image(resized)));
 }
 
+v8::Local<v8::Promise> NativeImage::ResizeAsync(gin::Arguments* args,
+                                                base::DictionaryValue options) {
+  float scale_factor = GetScaleFactorFromOptions(args);
+  gin_helper::Promise<gfx::Image> promise(args->isolate());
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+
+  gfx::Size size;
+  skia::ImageOperations::ResizeMethod method;
+  if (!GetResizeParameters(GetSize(scale_factor), options, &size, &method)) {
+    promise.Resolve(gfx::Image());
+    return handle;
+  }
+
+  // Unlike resize(), which resizes lazily, every representation is resized
+  // up front.
+  PostImageTask(
+      base::BindOnce(&ResizeReps, image_.AsImageSkia().image_reps(), size,
+                     method),
+      base::BindOnce(
+          [](gin_helper::Promise<gfx::Image> promise,
+             gfx::ImageSkia::ImageSkiaReps reps) {
+            promise.Resolve(ImageFromReps(reps));
+          },
+          std::move(promise)));
+  return handle;
+}
+
 gin::Handle<NativeImage> NativeImage::Crop(v8::Isolate* isolate,
                                            const gfx::Rect& rect) {
   gfx::ImageSkia cropped =
@@ -465,9 +677,7 @@ gin::Handle<NativeImage> NativeImage::CreateFromPath(
     return gin::CreateHandle(isolate, new NativeImage(isolate, image_path));
   }
 #endif
-  gfx::ImageSkia image_skia;
-  electron::util::PopulateImageSkiaRepsFromPath(&image_skia, image_path);
-  gfx::Image image(image_skia);
+  gfx::Image image(DecodedImageCache::GetInstance()->GetImage(image_path));
   gin::Handle<NativeImage> handle = Create(isolate, image);
 #if BUILDFLAG(IS_MAC)
   if (IsTemplateFilename(image_path))
@@ -552,6 +762,77 @@ gin::Handle<NativeImage> NativeImage::CreateFromBuffer(
   return Create(args->isolate(), gfx::Image(image_skia));
 }
 
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromPathAsync(
+    v8::Isolate* isolate,
+    const base::FilePath& path) {
+  gin_helper::Promise<gin::Handle<NativeImage>> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+#if BUILDFLAG(IS_WIN)
+  // Icons are loaded per size by GetHICON.
+  if (path.MatchesExtension(FILE_PATH_LITERAL(".ico"))) {
+    promise.Resolve(CreateFromPath(isolate, path));
+    return handle;
+  }
+#endif
+  PostImageTask(base::BindOnce(&DecodeFromPath, path),
+                base::BindOnce(
+                    [](gin_helper::Promise<gin::Handle<NativeImage>> promise,
+                       base::FilePath path,
+                       gfx::ImageSkia::ImageSkiaReps reps) {
+                      v8::Isolate* isolate = promise.isolate();
+                      gin_helper::Locker locker(isolate);
+                      v8::HandleScope handle_scope(isolate);
+                      v8::Context::Scope context_scope(promise.GetContext());
+                      gin::Handle<NativeImage> image =
+                          Create(isolate, ImageFromReps(reps));
+#if BUILDFLAG(IS_MAC)
+                      if (IsTemplateFilename(path))
+                        image->SetTemplateImage(true);
+#endif
+                      promise.Resolve(image);
+                    },
+                    std::move(promise), path));
+  return handle;
+}
+
+// static
+v8::Local<v8::Promise> NativeImage::CreateFromBufferAsync(
+    v8::Isolate* isolate,
+    v8::Local<v8::Value> buffer,
+    gin::Arguments* args) {
+  gin_helper::Promise<gfx::Image> promise(isolate);
+  v8::Local<v8::Promise> handle = promise.GetHandle();
+  if (!node::Buffer::HasInstance(buffer)) {
+    promise.RejectWithErrorMessage("buffer must be a node Buffer");
+    return handle;
+  }
+
+  int width = 0;
+  int height = 0;
+  double scale_factor = 1.;
+
+  gin_helper::Dictionary options;
+  if (args->GetNext(&options)) {
+    options.Get("width", &width);
+    options.Get("height", &height);
+    options.Get("scaleFactor", &scale_factor);
+  }
+
+  // Copy the data since the Buffer can change while decoding.
+  std::string data(node::Buffer::Data(buffer), node::Buffer::Length(buffer));
+  PostImageTask(
+      base::BindOnce(&DecodeFromBuffer, std::move(data), width, height,
+                     scale_factor),
+      base::BindOnce(
+          [](gin_helper::Promise<gfx::Image> promise,
+             gfx::ImageSkia::ImageSkiaReps reps) {
+            promise.Resolve(ImageFromReps(reps));
+          },
+          std::move(promise)));
+  return handle;
+}
+
 // static
 gin::Handle<NativeImage> NativeImage::CreateFromDataURL(v8::Isolate* isolate,
                                                         const GURL& url) {
@@ -588,12 +869,15 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
   return gin::ObjectTemplateBuilder(isolate, GetTypeName(),
                                     constructor->InstanceTemplate())
       .SetMethod("toPNG", &NativeImage::ToPNG)
+      .SetMethod("toPNGAsync", &NativeImage::ToPNGAsync)
       .SetMethod("toJPEG", &NativeImage::ToJPEG)
+      .SetMethod("toJPEGAsync", &NativeImage::ToJPEGAsync)
       .SetMethod("toBitmap", &NativeImage::ToBitmap)
       .SetMethod("getBitmap", &NativeImage::GetBitmap)
       .SetMethod("getScaleFactors", &NativeImage::GetScaleFactors)
       .SetMethod("getNativeHandle", &NativeImage::GetNativeHandle)
       .SetMethod("toDataURL", &NativeImage::ToDataURL)
+      .SetMethod("toDataURLAsync", &NativeImage::ToDataURLAsync)
       .SetMethod("isEmpty", &NativeImage::IsEmpty)
       .SetMethod("getSize", &NativeImage::GetSize)
       .SetMethod("setTemplateImage", &NativeImage::SetTemplateImage)
@@ -601,6 +885,7 @@ gin::ObjectTemplateBuilder NativeImage::GetObjectTemplateBuilder(
       .SetProperty("isMacTemplateImage", &NativeImage::IsTemplateImage,
                    &NativeImage::SetTemplateImage)
       .SetMethod("resize", &NativeImage::Resize)
+      .SetMethod("resizeAsync", &NativeImage::ResizeAsync)
       .SetMethod("crop", &NativeImage::Crop)
       .SetMethod("getAspectRatio", &NativeImage::GetAspectRatio)
       .SetMethod("addRepresentation", &NativeImage::AddRepresentation);
@@ -621,6 +906,22 @@ namespace {
 
 using electron::api::NativeImage;
 
+void SetCacheLimit(uint64_t limit) {
+  electron::DecodedImageCache::GetInstance()->SetLimit(limit);
+}
+
+v8::Local<v8::Value> GetCacheStats(v8::Isolate* isolate) {
+  auto stats = electron::DecodedImageCache::GetInstance()->GetStats();
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  dict.SetHidden("simple", true);
+  dict.Set("hits", stats.hits);
+  dict.Set("misses", stats.misses);
+  dict.Set("count", static_cast<uint64_t>(stats.entries));
+  dict.Set("size", static_cast<uint64_t>(stats.size));
+  dict.Set("limit", static_cast<uint64_t>(stats.limit));
+  return dict.GetHandle();
+}
+
 void Initialize(v8::Local<v8::Object> exports,
                 v8::Local<v8::Value> unused,
                 v8::Local<v8::Context> context,
@@ -632,8 +933,12 @@ void Initialize(v8::Local<v8::Object> exports,
 
   native_image.SetMethod("createEmpty", &NativeImage::CreateEmpty);
   native_image.SetMethod("createFromPath", &NativeImage::CreateFromPath);
+  native_image.SetMethod("createFromPathAsync",
+                         &NativeImage::CreateFromPathAsync);
   native_image.SetMethod("createFromBitmap", &NativeImage::CreateFromBitmap);
   native_image.SetMethod("createFromBuffer", &NativeImage::CreateFromBuffer);
+  native_image.SetMethod("createFromBufferAsync",
+                         &NativeImage::CreateFromBufferAsync);
   native_image.SetMethod("createFromDataURL", &NativeImage::CreateFromDataURL);
   native_image.SetMethod("createFromNamedImage",
                          &NativeImage::CreateFromNamedImage);
@@ -641,6 +946,8 @@ void Initialize(v8::Local<v8::Object> exports,
   native_image.SetMethod("createThumbnailFromPath",
                          &NativeImage::CreateThumbnailFromPath);
 #endif
+  native_image.SetMethod("setCacheLimit", &SetCacheLimit);
+  native_image.SetMethod("getCacheStats", &GetCacheStats);
 }
 
 }  // namespace
@@ -74,6 +74,14 @@ class NativeImage : public gin::Wrappable<NativeImage> {
       gin_helper::ErrorThrower thrower,
       v8::Local<v8::Value> buffer,
       gin::Arguments* args);
+  // Like CreateFromPath and CreateFromBuffer, but decode on the thread pool.
+  static v8::Local<v8::Promise> CreateFromPathAsync(
+      v8::Isolate* isolate,
+      const base::FilePath& path);
+  static v8::Local<v8::Promise> CreateFromBufferAsync(
+      v8::Isolate* isolate,
+      v8::Local<v8::Value> buffer,
+      gin::Arguments* args);
   static gin::Handle<NativeImage> CreateFromDataURL(v8::Isolate* isolate,
                                                     const GURL& url);
   static gin::Handle<NativeImage> CreateFromNamedImage(gin::Arguments* args,
@@ -116,6 +124,12 @@ class NativeImage : public gin::Wrappable<NativeImage> {
                                   base::DictionaryValue options);
   gin::Handle<NativeImage> Crop(v8::Isolate* isolate, const gfx::Rect& rect);
   std::string ToDataURL(gin::Arguments* args);
+  // Promise versions of the above that encode or resize on the thread pool.
+  v8::Local<v8::Promise> ToPNGAsync(gin::Arguments* args);
+  v8::Local<v8::Promise> ToJPEGAsync(v8::Isolate* isolate, int quality);
+  v8::Local<v8::Promise> ToDataURLAsync(gin::Arguments* args);
+  v8::Local<v8::Promise> ResizeAsync(gin::Arguments* args,
+                                     base::DictionaryValue options);
   bool IsEmpty();
   gfx::Size GetSize(const absl::optional<float> scale_factor);
   float GetAspectRatio(const absl::optional<float> scale_factor);
@@ -20,6 +20,7 @@
 #include "services/resource_coordinator/public/cpp/memory_instrumentation/global_memory_dump.h"
 #include "services/resource_coordinator/public/cpp/memory_instrumentation/memory_instrumentation.h"
 #include "shell/browser/browser.h"
+#include "shell/browser/javascript_environment.h"
 #include "shell/common/application_info.h"
 #include "shell/common/gin_converters/file_path_converter.h"
 #include "shell/common/gin_helper/dictionary.h"
@@ -27,6 +28,7 @@
 #include "shell/common/gin_helper/microtasks_scope.h"
 #include "shell/common/gin_helper/promise.h"
 #include "shell/common/heap_snapshot.h"
+#include "shell/common/ipc_channel_metrics.h"
 #include "shell/common/node_includes.h"
 #include "third_party/blink/renderer/platform/heap/process_heap.h"  // nogncheck
 
@@ -52,11 +54,14 @@ void ElectronBindings::BindProcess(v8::Isolate* isolate,
   process->SetMethod("getBlinkMemoryInfo", &GetBlinkMemoryInfo);
   if (gin_helper::Locker::IsBrowserProcess()) {
     process->SetMethod("getProcessMemoryInfo", &GetProcessMemoryInfo);
+    process->SetMethod("getArrayBufferAllocatorInfo",
+                       &GetArrayBufferAllocatorInfo);
   }
   process->SetMethod("getSystemMemoryInfo", &GetSystemMemoryInfo);
   process->SetMethod("getSystemVersion",
                      &base::SysInfo::OperatingSystemVersion);
   process->SetMethod("getIOCounters", &GetIOCounters);
+  process->SetMethod("getIPCChannelMetrics", &GetIPCChannelMetrics);
   process->SetMethod("getCPUUsage",
                      base::BindRepeating(&ElectronBindings::GetCPUUsage,
                                          base::Unretained(metrics)));
@@ -242,6 +247,55 @@ v8::Local<v8::Value> ElectronBindings::GetBlinkMemoryInfo(
   return dict.GetHandle();
 }
 
+// static
+v8::Local<v8::Value> ElectronBindings::GetArrayBufferAllocatorInfo(
+    v8::Isolate* isolate) {
+  CHECK(gin_helper::Locker::IsBrowserProcess());
+  auto info = JavascriptEnvironment::GetArrayBufferAllocatorInfo();
+
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  dict.SetHidden("simple", true);
+  dict.Set("allocated", static_cast<double>(info.allocated_bytes >> 10));
+  dict.Set("committed", static_cast<double>(info.committed_bytes >> 10));
+  dict.Set("allocationCount", static_cast<double>(info.allocation_count));
+  dict.Set("totalAllocated",
+           static_cast<double>(info.total_allocated_bytes >> 10));
+  return dict.GetHandle();
+}
+
+// static
+v8::Local<v8::Value> ElectronBindings::GetIPCChannelMetrics(
+    v8::Isolate* isolate) {
+  auto* metrics = IPCChannelMetrics::GetInstance();
+  const auto& entries = metrics->entries();
+  const IPCChannelMetrics::Entry& other = metrics->other();
+  bool has_other = other.sent || other.received;
+  v8::Local<v8::Array> result =
+      v8::Array::New(isolate, entries.size() + (has_other ? 1 : 0));
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  uint32_t index = 0;
+  auto add_entry = [&](const std::string& channel,
+                       const IPCChannelMetrics::Entry& entry, bool other) {
+    gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+    dict.SetHidden("simple", true);
+    dict.Set("channel", channel);
+    if (other)
+      dict.Set("other", true);
+    dict.Set("sent", static_cast<double>(entry.sent));
+    dict.Set("received", static_cast<double>(entry.received));
+    dict.Set("bytesSent", static_cast<double>(entry.bytes_sent));
+    dict.Set("bytesReceived", static_cast<double>(entry.bytes_received));
+    dict.Set("serializationTime", entry.serialization_time.InMillisecondsF());
+    dict.Set("handlerTime", entry.handler_time.InMillisecondsF());
+    result->Set(context, index++, dict.GetHandle()).Check();
+  };
+  for (const auto& it : entries)
+    add_entry(it.first, it.second, false);
+  if (has_other)
+    add_entry(std::string(), other, true);
+  return result;
+}
+
 // static
 void ElectronBindings::DidReceiveMemoryDump(
     v8::Global<v8::Context> context,
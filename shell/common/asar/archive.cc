@@ -17,6 +17,7 @@
 #include "base/strings/string_number_conversions.h"
 #include "base/task/post_task.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
 #include "electron/fuses.h"
 #include "shell/common/asar/asar_util.h"
@@ -198,6 +199,8 @@ Archive::~Archive() {
 }
 
 bool Archive::Init() {
+  TRACE_EVENT1("electron", "Archive::Init", "path", path_.AsUTF8Unsafe());
+
   // Should only be initialized once
   CHECK(!initialized_);
   initialized_ = true;
@@ -374,6 +377,7 @@ bool Archive::Realpath(const base::FilePath& path,
 }
 
 bool Archive::CopyFileOut(const base::FilePath& path, base::FilePath* out) {
+  TRACE_EVENT0("electron", "Archive::CopyFileOut");
   if (!header_)
     return false;
 
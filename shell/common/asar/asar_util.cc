@@ -19,6 +19,7 @@
 #include "base/synchronization/lock.h"
 #include "base/threading/thread_local.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/trace_event/trace_event.h"
 #include "crypto/secure_hash.h"
 #include "crypto/sha2.h"
 #include "shell/common/asar/archive.h"
@@ -111,6 +112,7 @@ bool GetAsarArchivePath(const base::FilePath& full_path,
 }
 
 bool ReadFileToString(const base::FilePath& path, std::string* contents) {
+  TRACE_EVENT0("electron", "asar::ReadFileToString");
   base::FilePath asar_path, relative_path;
   if (!GetAsarArchivePath(path, &asar_path, &relative_path))
     return base::ReadFileToString(path, contents);
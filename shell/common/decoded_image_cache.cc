@@ -0,0 +1,142 @@
+// Copyright (c) 2022 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/decoded_image_cache.h"
+
+#include "base/files/file_util.h"
+#include "base/threading/thread_restrictions.h"
+#include "shell/common/asar/asar_util.h"
+#include "shell/common/skia_util.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+namespace electron {
+
+namespace {
+
+// Large enough for the icons of a typical app at a few scale factors.
+constexpr size_t kDefaultLimit = 16 * 1024 * 1024;
+
+}  // namespace
+
+// static
+DecodedImageCache::FileState DecodedImageCache::GetFileState(
+    const base::FilePath& path) {
+  FileState state;
+  state.path = path;
+  base::FilePath file_path = path;
+  base::FilePath asar_path, relative_path;
+  if (asar::GetAsarArchivePath(path, &asar_path, &relative_path))
+    file_path = asar_path;
+
+  base::ThreadRestrictions::ScopedAllowIO allow_io;
+  base::File::Info info;
+  if (base::GetFileInfo(file_path, &info)) {
+    state.last_modified = info.last_modified;
+    state.size = info.size;
+  }
+  return state;
+}
+
+// static
+bool DecodedImageCache::IsUpToDate(const std::vector<FileState>& files) {
+  for (const auto& file : files) {
+    FileState state = GetFileState(file.path);
+    if (state.last_modified != file.last_modified || state.size != file.size)
+      return false;
+  }
+  return true;
+}
+
+DecodedImageCache::Entry::Entry() = default;
+
+DecodedImageCache::Entry::Entry(const Entry&) = default;
+
+DecodedImageCache::Entry::~Entry() = default;
+
+// static
+DecodedImageCache* DecodedImageCache::GetInstance() {
+  static base::NoDestructor<DecodedImageCache> instance;
+  return instance.get();
+}
+
+DecodedImageCache::DecodedImageCache()
+    : cache_(base::LRUCache<base::FilePath, Entry>::NO_AUTO_EVICT),
+      limit_(kDefaultLimit) {}
+
+DecodedImageCache::~DecodedImageCache() = default;
+
+gfx::ImageSkia DecodedImageCache::GetImage(const base::FilePath& path) {
+  Entry cached;
+  {
+    base::AutoLock auto_lock(lock_);
+    auto it = cache_.Get(path);
+    if (it != cache_.end())
+      cached = it->second;
+  }
+
+  // Check the files without holding the lock.
+  if (!cached.image.isNull() && IsUpToDate(cached.files)) {
+    base::AutoLock auto_lock(lock_);
+    hits_++;
+    return cached.image.DeepCopy();
+  }
+
+  Entry entry;
+  std::vector<base::FilePath> loaded_paths;
+  util::PopulateImageSkiaRepsFromPath(&entry.image, path, &loaded_paths);
+  for (const auto& loaded_path : loaded_paths)
+    entry.files.push_back(GetFileState(loaded_path));
+  for (const auto& rep : entry.image.image_reps())
+    entry.size += rep.GetBitmap().computeByteSize();
+
+  base::AutoLock auto_lock(lock_);
+  misses_++;
+  auto it = cache_.Peek(path);
+  if (it != cache_.end()) {
+    size_ -= it->second.size;
+    cache_.Erase(it);
+  }
+  if (entry.image.isNull() || entry.size > limit_)
+    return entry.image;
+
+  // Read-only images can be copied on any thread, and the pixels are shared
+  // with every image returned for |path|.
+  entry.image.MakeThreadSafe();
+  for (const auto& rep : entry.image.image_reps()) {
+    SkBitmap bitmap = rep.GetBitmap();
+    bitmap.setImmutable();
+  }
+  gfx::ImageSkia image = entry.image.DeepCopy();
+  size_ += entry.size;
+  cache_.Put(path, std::move(entry));
+  EvictIfNeeded();
+  return image;
+}
+
+void DecodedImageCache::SetLimit(size_t limit) {
+  base::AutoLock auto_lock(lock_);
+  limit_ = limit;
+  EvictIfNeeded();
+}
+
+DecodedImageCache::Stats DecodedImageCache::GetStats() {
+  base::AutoLock auto_lock(lock_);
+  Stats stats;
+  stats.hits = hits_;
+  stats.misses = misses_;
+  stats.entries = cache_.size();
+  stats.size = size_;
+  stats.limit = limit_;
+  return stats;
+}
+
+void DecodedImageCache::EvictIfNeeded() {
+  while (size_ > limit_ && !cache_.empty()) {
+    auto oldest = cache_.rbegin();
+    size_ -= oldest->second.size;
+    cache_.Erase(oldest);
+  }
+}
+
+}  // namespace electron
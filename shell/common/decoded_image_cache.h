@@ -0,0 +1,93 @@
+// Copyright (c) 2022 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_DECODED_IMAGE_CACHE_H_
+#define ELECTRON_SHELL_COMMON_DECODED_IMAGE_CACHE_H_
+
+#include <vector>
+
+#include "base/containers/lru_cache.h"
+#include "base/files/file_path.h"
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
+#include "ui/gfx/image/image_skia.h"
+
+namespace electron {
+
+// Process-wide LRU cache of the images decoded from files, so an icon used by
+// many windows, menus and trays is decoded and kept in memory only once.
+//
+// Entries are keyed by the normalized path, and are dropped when the
+// modification time or size of any file they were decoded from changes. Files
+// in an asar archive use those of the archive.
+class DecodedImageCache {
+ public:
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t entries = 0;
+    size_t size = 0;
+    size_t limit = 0;
+  };
+
+  static DecodedImageCache* GetInstance();
+
+  // disable copy
+  DecodedImageCache(const DecodedImageCache&) = delete;
+  DecodedImageCache& operator=(const DecodedImageCache&) = delete;
+
+  // Returns the image decoded from |path| and its scale variants, from the
+  // cache when possible. The result has its own storage, so adding
+  // representations to it does not change the cache, but shares the pixel
+  // data of the cached image, which is marked immutable and must be copied
+  // before being written to. Can be called from any thread.
+  gfx::ImageSkia GetImage(const base::FilePath& path);
+
+  // Sets the memory budget in bytes of the decoded pixels, 0 disables the
+  // cache.
+  void SetLimit(size_t limit);
+
+  Stats GetStats();
+
+ private:
+  friend class base::NoDestructor<DecodedImageCache>;
+
+  struct FileState {
+    base::FilePath path;
+    base::Time last_modified;
+    int64_t size = -1;
+  };
+
+  struct Entry {
+    Entry();
+    Entry(const Entry&);
+    ~Entry();
+
+    gfx::ImageSkia image;
+    // The files |image| was decoded from, when it was decoded.
+    std::vector<FileState> files;
+    size_t size = 0;
+  };
+
+  DecodedImageCache();
+  ~DecodedImageCache();
+
+  static FileState GetFileState(const base::FilePath& path);
+  static bool IsUpToDate(const std::vector<FileState>& files);
+
+  // Evicts the least recently used entries until the cache fits |limit_|.
+  void EvictIfNeeded();
+
+  base::Lock lock_;
+  base::LRUCache<base::FilePath, Entry> cache_;
+  size_t size_ = 0;
+  size_t limit_;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_DECODED_IMAGE_CACHE_H_
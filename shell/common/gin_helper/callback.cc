@@ -4,17 +4,25 @@
 
 #include "shell/common/gin_helper/callback.h"
 
-#include "base/cxx17_backports.h"
+#include <memory>
+
 #include "content/public/browser/browser_thread.h"
-#include "gin/dictionary.h"
 
 namespace gin_helper {
 
 namespace {
 
+// Cached template of the state object bound to each translater function, its
+// internal field points to the TranslaterHolder.
+v8::Persistent<v8::ObjectTemplate> g_translater_state;
+
 struct TranslaterHolder {
-  explicit TranslaterHolder(v8::Isolate* isolate)
-      : handle(isolate, v8::External::New(isolate, this)) {
+  TranslaterHolder(v8::Isolate* isolate,
+                   v8::Local<v8::Object> state,
+                   const Translater& translater,
+                   bool one_time)
+      : handle(isolate, state), translater(translater), one_time(one_time) {
+    state->SetAlignedPointerInInternalField(0, this);
     handle.SetWeak(this, &GC, v8::WeakCallbackType::kFinalizer);
   }
   ~TranslaterHolder() {
@@ -28,40 +36,31 @@ struct TranslaterHolder {
     delete data.GetParameter();
   }
 
-  v8::Global<v8::External> handle;
+  v8::Global<v8::Object> handle;
   Translater translater;
+  // Whether the callback should only be called once.
+  const bool one_time;
 };
 
-// Cached JavaScript version of |CallTranslater|.
-v8::Persistent<v8::FunctionTemplate> g_call_translater;
+void CallTranslater(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  gin::Arguments args(info);
+  v8::Local<v8::Object> state = info.Data().As<v8::Object>();
+  auto* holder = static_cast<TranslaterHolder*>(
+      state->GetAlignedPointerFromInternalField(0));
 
-void CallTranslater(v8::Local<v8::External> external,
-                    v8::Local<v8::Object> state,
-                    gin::Arguments* args) {
-  // Whether the callback should only be called once.
-  v8::Isolate* isolate = args->isolate();
-  auto context = isolate->GetCurrentContext();
-  bool one_time =
-      state->Has(context, gin::StringToSymbol(isolate, "oneTime")).ToChecked();
-
-  // Check if the callback has already been called.
-  if (one_time) {
-    auto called_symbol = gin::StringToSymbol(isolate, "called");
-    if (state->Has(context, called_symbol).ToChecked()) {
-      args->ThrowTypeError("One-time callback was called more than once");
-      return;
-    } else {
-      state->Set(context, called_symbol, v8::Boolean::New(isolate, true))
-          .ToChecked();
-    }
+  // The holder of a one-time callback is freed by its first call.
+  if (!holder) {
+    args.ThrowTypeError("One-time callback was called more than once");
+    return;
   }
 
-  auto* holder = static_cast<TranslaterHolder*>(external->Value());
-  holder->translater.Run(args);
-
-  // Free immediately for one-time callback.
-  if (one_time)
-    delete holder;
+  if (holder->one_time) {
+    state->SetAlignedPointerInInternalField(0, nullptr);
+    std::unique_ptr<TranslaterHolder> owned(holder);
+    owned->translater.Run(&args);
+  } else {
+    holder->translater.Run(&args);
+  }
 }
 
 }  // namespace
@@ -116,38 +115,23 @@ v8::Local<v8::Function> SafeV8Function::NewHandle(v8::Isolate* isolate) const {
 v8::Local<v8::Value> CreateFunctionFromTranslater(v8::Isolate* isolate,
                                                   const Translater& translater,
                                                   bool one_time) {
-  // The FunctionTemplate is cached.
-  if (g_call_translater.IsEmpty())
-    g_call_translater.Reset(
-        isolate,
-        CreateFunctionTemplate(isolate, base::BindRepeating(&CallTranslater)));
-
-  v8::Local<v8::FunctionTemplate> call_translater =
-      v8::Local<v8::FunctionTemplate>::New(isolate, g_call_translater);
-  auto* holder = new TranslaterHolder(isolate);
-  holder->translater = translater;
-  gin::Dictionary state = gin::Dictionary::CreateEmpty(isolate);
-  if (one_time)
-    state.Set("oneTime", true);
-  auto context = isolate->GetCurrentContext();
-  return BindFunctionWith(
-      isolate, context, call_translater->GetFunction(context).ToLocalChecked(),
-      holder->handle.Get(isolate), gin::ConvertToV8(isolate, state));
-}
+  // The ObjectTemplate is cached.
+  if (g_translater_state.IsEmpty()) {
+    v8::Local<v8::ObjectTemplate> state_template =
+        v8::ObjectTemplate::New(isolate);
+    state_template->SetInternalFieldCount(1);
+    g_translater_state.Reset(isolate, state_template);
+  }
 
-// func.bind(func, arg1).
-// NB(zcbenz): Using C++11 version crashes VS.
-v8::Local<v8::Value> BindFunctionWith(v8::Isolate* isolate,
-                                      v8::Local<v8::Context> context,
-                                      v8::Local<v8::Function> func,
-                                      v8::Local<v8::Value> arg1,
-                                      v8::Local<v8::Value> arg2) {
-  v8::MaybeLocal<v8::Value> bind =
-      func->Get(context, gin::StringToV8(isolate, "bind"));
-  CHECK(!bind.IsEmpty());
-  v8::Local<v8::Function> bind_func = bind.ToLocalChecked().As<v8::Function>();
-  v8::Local<v8::Value> converted[] = {func, arg1, arg2};
-  return bind_func->Call(context, func, base::size(converted), converted)
+  auto context = isolate->GetCurrentContext();
+  v8::Local<v8::Object> state =
+      v8::Local<v8::ObjectTemplate>::New(isolate, g_translater_state)
+          ->NewInstance(context)
+          .ToLocalChecked();
+  // Owned by |state|, or by itself after a one-time call.
+  new TranslaterHolder(isolate, state, translater, one_time);
+  return v8::Function::New(context, &CallTranslater, state, 0,
+                           v8::ConstructorBehavior::kThrow)
       .ToLocalChecked();
 }
 
@@ -6,6 +6,7 @@
 
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/render_process_host.h"
+#include "shell/browser/api/electron_api_event_emitter.h"
 #include "shell/browser/api/event.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/object_template_builder.h"
@@ -18,10 +19,29 @@ namespace {
 
 v8::Persistent<v8::ObjectTemplate> event_template;
 
+// Property names looked up on every emit, internalized once.
+v8::Eternal<v8::String> default_prevented_key;
+v8::Eternal<v8::String> emit_key;
+v8::Eternal<v8::String> events_key;
+v8::Eternal<v8::String> sender_key;
+
+v8::Local<v8::String> GetKey(v8::Isolate* isolate,
+                             v8::Eternal<v8::String>* key,
+                             const char* name) {
+  if (key->IsEmpty())
+    key->Set(isolate, gin::StringToSymbol(isolate, name));
+  return key->Get(isolate);
+}
+
 void PreventDefault(gin_helper::Arguments* args) {
-  Dictionary self;
-  if (args->GetHolder(&self))
-    self.Set("defaultPrevented", true);
+  v8::Local<v8::Object> self;
+  if (args->GetHolder(&self)) {
+    v8::Isolate* isolate = args->isolate();
+    self->Set(isolate->GetCurrentContext(),
+              GetKey(isolate, &default_prevented_key, "defaultPrevented"),
+              v8::True(isolate))
+        .Check();
+  }
 }
 
 }  // namespace
@@ -44,7 +64,7 @@ v8::Local<v8::Object> CreateCustomEvent(v8::Isolate* isolate,
           ->NewInstance(context)
           .ToLocalChecked();
   if (!sender.IsEmpty())
-    Dictionary(isolate, event).Set("sender", sender);
+    event->Set(context, GetKey(isolate, &sender_key, "sender"), sender).Check();
   if (!custom_event.IsEmpty())
     event->SetPrototype(context, custom_event).IsJust();
   return event;
@@ -75,6 +95,51 @@ v8::Local<v8::Object> CreateNativeEvent(
   return event;
 }
 
+bool HasListeners(v8::Isolate* isolate,
+                  v8::Local<v8::Object> obj,
+                  base::StringPiece name) {
+  // EventEmitter throws for "error" events without listeners.
+  if (name == "error")
+    return true;
+
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::String> key = GetKey(isolate, &emit_key, "emit");
+  v8::Local<v8::Value> emit;
+  v8::Local<v8::Value> stock_emit;
+  if (!obj->Get(context, key).ToLocal(&emit) ||
+      !electron::GetEventEmitterPrototype(isolate)
+           ->Get(context, key)
+           .ToLocal(&stock_emit) ||
+      emit != stock_emit)
+    return true;
+
+  // Listeners are kept in |_events|, which is only created when the first
+  // listener is added.
+  v8::Local<v8::Value> events;
+  if (!obj->Get(context, GetKey(isolate, &events_key, "_events"))
+           .ToLocal(&events))
+    return true;
+  if (!events->IsObject())
+    return false;
+  v8::Local<v8::Value> listeners;
+  if (!events.As<v8::Object>()
+           ->Get(context, gin::StringToSymbol(isolate, name))
+           .ToLocal(&listeners))
+    return true;
+  return !listeners->IsUndefined();
+}
+
+bool IsDefaultPrevented(v8::Isolate* isolate, v8::Local<v8::Object> event) {
+  v8::Local<v8::Value> default_prevented;
+  if (event
+          ->Get(isolate->GetCurrentContext(),
+                GetKey(isolate, &default_prevented_key, "defaultPrevented"))
+          .ToLocal(&default_prevented)) {
+    return default_prevented->BooleanValue(isolate);
+  }
+  return false;
+}
+
 }  // namespace internal
 
 }  // namespace gin_helper
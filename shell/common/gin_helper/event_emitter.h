@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/strings/string_piece.h"
 #include "content/public/browser/browser_thread.h"
 #include "electron/shell/common/api/api.mojom.h"
 #include "shell/common/gin_helper/event_emitter_caller.h"
@@ -31,6 +32,15 @@ v8::Local<v8::Object> CreateNativeEvent(
     content::RenderFrameHost* frame,
     electron::mojom::ElectronBrowser::MessageSyncCallback callback);
 
+// Returns false if |obj| uses the stock EventEmitter.prototype.emit and has no
+// listener for |name|, in which case emitting it would be a no-op.
+bool HasListeners(v8::Isolate* isolate,
+                  v8::Local<v8::Object> obj,
+                  base::StringPiece name);
+
+// Returns whether event.preventDefault() was called.
+bool IsDefaultPrevented(v8::Isolate* isolate, v8::Local<v8::Object> event);
+
 }  // namespace internal
 
 // Provide helperers to emit event in JavaScript.
@@ -66,6 +76,9 @@ class EventEmitter : public gin_helper::Wrappable<T> {
     v8::Local<v8::Object> wrapper = GetWrapper();
     if (wrapper.IsEmpty())
       return false;
+    // Skip creating the event and entering JS when nobody is listening.
+    if (!internal::HasListeners(isolate(), wrapper, name))
+      return false;
     v8::Local<v8::Object> event =
         internal::CreateCustomEvent(isolate(), wrapper);
     return EmitWithEvent(name, event, std::forward<Args>(args)...);
@@ -87,15 +100,9 @@ class EventEmitter : public gin_helper::Wrappable<T> {
     // It's possible that |this| will be deleted by EmitEvent, so save anything
     // we need from |this| before calling EmitEvent.
     auto* isolate = this->isolate();
-    auto context = isolate->GetCurrentContext();
     gin_helper::EmitEvent(isolate, GetWrapper(), name, event,
                           std::forward<Args>(args)...);
-    v8::Local<v8::Value> defaultPrevented;
-    if (event->Get(context, gin::StringToV8(isolate, "defaultPrevented"))
-            .ToLocal(&defaultPrevented)) {
-      return defaultPrevented->BooleanValue(isolate);
-    }
-    return false;
+    return internal::IsDefaultPrevented(isolate, event);
   }
 };
 
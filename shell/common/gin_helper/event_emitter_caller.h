@@ -5,9 +5,11 @@
 #ifndef ELECTRON_SHELL_COMMON_GIN_HELPER_EVENT_EMITTER_CALLER_H_
 #define ELECTRON_SHELL_COMMON_GIN_HELPER_EVENT_EMITTER_CALLER_H_
 
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "base/trace_event/trace_event.h"
 #include "gin/converter.h"
 #include "gin/wrappable.h"
 
@@ -31,6 +33,7 @@ v8::Local<v8::Value> EmitEvent(v8::Isolate* isolate,
                                v8::Local<v8::Object> obj,
                                const StringType& name,
                                const internal::ValueVector& args) {
+  TRACE_EVENT1("electron", "EmitEvent", "name", std::string(name));
   internal::ValueVector concatenated_args = {gin::StringToV8(isolate, name)};
   concatenated_args.reserve(1 + args.size());
   concatenated_args.insert(concatenated_args.end(), args.begin(), args.end());
@@ -44,6 +47,7 @@ v8::Local<v8::Value> EmitEvent(v8::Isolate* isolate,
                                v8::Local<v8::Object> obj,
                                const StringType& name,
                                Args&&... args) {
+  TRACE_EVENT1("electron", "EmitEvent", "name", std::string(name));
   internal::ValueVector converted_args = {
       gin::StringToV8(isolate, name),
       gin::ConvertToV8(isolate, std::forward<Args>(args))...,
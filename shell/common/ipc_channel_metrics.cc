@@ -0,0 +1,82 @@
+// Copyright (c) 2022 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#include "shell/common/ipc_channel_metrics.h"
+
+#include <algorithm>
+
+namespace electron {
+
+namespace {
+
+uint64_t MessageCount(const IPCChannelMetrics::Entry& entry) {
+  return entry.sent + entry.received;
+}
+
+void AddTo(IPCChannelMetrics::Entry* total,
+           const IPCChannelMetrics::Entry& entry) {
+  total->sent += entry.sent;
+  total->received += entry.received;
+  total->bytes_sent += entry.bytes_sent;
+  total->bytes_received += entry.bytes_received;
+  total->serialization_time += entry.serialization_time;
+  total->handler_time += entry.handler_time;
+}
+
+}  // namespace
+
+// static
+IPCChannelMetrics* IPCChannelMetrics::GetInstance() {
+  static base::NoDestructor<IPCChannelMetrics> instance;
+  return instance.get();
+}
+
+IPCChannelMetrics::IPCChannelMetrics() = default;
+
+IPCChannelMetrics::~IPCChannelMetrics() = default;
+
+void IPCChannelMetrics::RecordSent(const std::string& channel,
+                                   size_t bytes,
+                                   base::TimeDelta serialization_time) {
+  Entry& entry = GetEntry(channel);
+  entry.sent++;
+  entry.bytes_sent += bytes;
+  entry.serialization_time += serialization_time;
+}
+
+void IPCChannelMetrics::RecordReceived(const std::string& channel,
+                                       size_t bytes,
+                                       base::TimeDelta handler_time) {
+  Entry& entry = GetEntry(channel);
+  entry.received++;
+  entry.bytes_received += bytes;
+  entry.handler_time += handler_time;
+}
+
+IPCChannelMetrics::Entry& IPCChannelMetrics::GetEntry(
+    const std::string& channel) {
+  auto it = entries_.find(channel);
+  if (it != entries_.end())
+    return it->second;
+  if (entries_.size() >= kMaxChannels) {
+    auto quietest = std::min_element(
+        entries_.begin(), entries_.end(), [](const auto& a, const auto& b) {
+          return MessageCount(a.second) < MessageCount(b.second);
+        });
+    AddTo(&other_, quietest->second);
+    entries_.erase(quietest);
+  }
+  return entries_[channel];
+}
+
+ScopedIPCChannelReceive::ScopedIPCChannelReceive(const std::string& channel,
+                                                 size_t bytes)
+    : channel_(channel), bytes_(bytes), start_(base::TimeTicks::Now()) {}
+
+ScopedIPCChannelReceive::~ScopedIPCChannelReceive() {
+  IPCChannelMetrics::GetInstance()->RecordReceived(
+      channel_, bytes_, base::TimeTicks::Now() - start_);
+}
+
+}  // namespace electron
@@ -0,0 +1,86 @@
+// Copyright (c) 2022 Microsoft, Inc.
+// Use of this source code is governed by the MIT license that can be
+// found in the LICENSE file.
+
+#ifndef ELECTRON_SHELL_COMMON_IPC_CHANNEL_METRICS_H_
+#define ELECTRON_SHELL_COMMON_IPC_CHANNEL_METRICS_H_
+
+#include <map>
+#include <string>
+
+#include "base/no_destructor.h"
+#include "base/time/time.h"
+
+namespace electron {
+
+// Per-channel IPC volume of the current process, so noisy channels can be
+// found without instrumenting JS. Only used on the main thread.
+//
+// Apps may use a new channel per request, so at most kMaxChannels channels get
+// their own entry. Once the table is full, a new channel replaces the one with
+// the fewest messages, whose counts are folded into other(), so long-lived
+// noisy channels keep their entries.
+class IPCChannelMetrics {
+ public:
+  static constexpr size_t kMaxChannels = 256;
+
+  struct Entry {
+    uint64_t sent = 0;
+    uint64_t received = 0;
+    uint64_t bytes_sent = 0;
+    uint64_t bytes_received = 0;
+    // Time spent serializing outgoing arguments.
+    base::TimeDelta serialization_time;
+    // Time spent deserializing and dispatching incoming messages to JS.
+    base::TimeDelta handler_time;
+  };
+
+  static IPCChannelMetrics* GetInstance();
+
+  // disable copy
+  IPCChannelMetrics(const IPCChannelMetrics&) = delete;
+  IPCChannelMetrics& operator=(const IPCChannelMetrics&) = delete;
+
+  void RecordSent(const std::string& channel,
+                  size_t bytes,
+                  base::TimeDelta serialization_time);
+  void RecordReceived(const std::string& channel,
+                      size_t bytes,
+                      base::TimeDelta handler_time);
+
+  const std::map<std::string, Entry>& entries() const { return entries_; }
+  const Entry& other() const { return other_; }
+
+ private:
+  friend class base::NoDestructor<IPCChannelMetrics>;
+
+  IPCChannelMetrics();
+  ~IPCChannelMetrics();
+
+  Entry& GetEntry(const std::string& channel);
+
+  std::map<std::string, Entry> entries_;
+  Entry other_;
+};
+
+// Records a message received on |channel| of |bytes|, and the time until the
+// end of the scope as its handler time.
+class ScopedIPCChannelReceive {
+ public:
+  ScopedIPCChannelReceive(const std::string& channel, size_t bytes);
+  ~ScopedIPCChannelReceive();
+
+  // disable copy
+  ScopedIPCChannelReceive(const ScopedIPCChannelReceive&) = delete;
+  ScopedIPCChannelReceive& operator=(const ScopedIPCChannelReceive&) = delete;
+
+ private:
+  // A copy, since the handler run in this scope may free the caller's string.
+  const std::string channel_;
+  const size_t bytes_;
+  const base::TimeTicks start_;
+};
+
+}  // namespace electron
+
+#endif  // ELECTRON_SHELL_COMMON_IPC_CHANNEL_METRICS_H_
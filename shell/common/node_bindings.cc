@@ -325,17 +325,20 @@ NodeBindings::NodeBindings(BrowserEnvironment browser_env)
 }
 
 NodeBindings::~NodeBindings() {
-  // Quit the embed thread.
-  embed_closed_ = true;
-  uv_sem_post(&embed_sem_);
+  if (embed_thread_started_) {
+    // Quit the embed thread.
+    embed_closed_ = true;
+    uv_sem_post(&embed_sem_);
 
-  WakeupEmbedThread();
+    WakeupEmbedThread();
 
-  // Wait for everything to be done.
-  uv_thread_join(&embed_thread_);
+    // Wait for everything to be done.
+    uv_thread_join(&embed_thread_);
+
+    uv_sem_destroy(&embed_sem_);
+  }
 
   // Clear uv.
-  uv_sem_destroy(&embed_sem_);
   dummy_uv_handle_.reset();
 
   // Clean up worker loop
@@ -478,9 +481,13 @@ node::Environment* NodeBindings::CreateEnvironment(
   }
 
   v8::TryCatch try_catch(isolate);
-  env = node::CreateEnvironment(
-      isolate_data_, context, args, exec_args,
-      static_cast<node::EnvironmentFlags::Flags>(flags));
+  {
+    TRACE_EVENT1("electron", "NodeBindings::CreateEnvironment", "process_type",
+                 process_type);
+    env = node::CreateEnvironment(
+        isolate_data_, context, args, exec_args,
+        static_cast<node::EnvironmentFlags::Flags>(flags));
+  }
 
   if (try_catch.HasCaught()) {
     std::string err_msg =
@@ -568,6 +575,7 @@ node::Environment* NodeBindings::CreateEnvironment(
 }
 
 void NodeBindings::LoadEnvironment(node::Environment* env) {
+  TRACE_EVENT0("electron", "NodeBindings::LoadEnvironment");
   node::LoadEnvironment(env, node::StartExecutionCallback{});
   gin_helper::EmitEvent(env->isolate(), env->process_object(), "loaded");
 }
@@ -587,9 +595,14 @@ void NodeBindings::PrepareMessageLoop() {
   // nothing to do.
   uv_async_init(uv_loop_, dummy_uv_handle_.get(), nullptr);
 
+  // The platform watches the uv loop from the message pump by itself.
+  if (PollInMessagePump())
+    return;
+
   // Start worker that will interrupt main loop when having uv events.
   uv_sem_init(&embed_sem_, 0);
   uv_thread_create(&embed_thread_, EmbedThreadRunner, this);
+  embed_thread_started_ = true;
 }
 
 void NodeBindings::RunMessageLoop() {
@@ -638,8 +651,12 @@ void NodeBindings::UvRunOnce() {
   if (r == 0)
     base::RunLoop().QuitWhenIdle();  // Quit from uv.
 
-  // Tell the worker thread to continue polling.
-  uv_sem_post(&embed_sem_);
+  if (embed_thread_started_) {
+    // Tell the worker thread to continue polling.
+    uv_sem_post(&embed_sem_);
+  } else {
+    ScheduleUvRun();
+  }
 }
 
 void NodeBindings::WakeupMainThread() {
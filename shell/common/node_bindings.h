@@ -118,6 +118,15 @@ class NodeBindings {
   // Called to poll events in new thread.
   virtual void PollEvents() = 0;
 
+  // Called by PrepareMessageLoop, returns true when the platform watches the
+  // uv loop from the current thread's message pump, in which case the embed
+  // thread is not started.
+  virtual bool PollInMessagePump() { return false; }
+
+  // Called after each UvRunOnce when there is no embed thread, so that the
+  // platform can arm the wakeup for the next uv timer.
+  virtual void ScheduleUvRun() {}
+
   // Run the libuv loop for once.
   void UvRunOnce();
 
@@ -143,6 +152,9 @@ class NodeBindings {
   // Whether the libuv loop has ended.
   bool embed_closed_ = false;
 
+  // Whether PrepareMessageLoop has started the embed thread.
+  bool embed_thread_started_ = false;
+
   // Loop used when constructed in WORKER mode
   uv_loop_t worker_loop_;
 
@@ -6,6 +6,20 @@
 
 #include <sys/epoll.h>
 
+#include "base/bind.h"
+#include "base/feature_list.h"
+#include "base/task/current_thread.h"
+
+namespace features {
+
+// Watch the uv loop of the browser process from the UI thread's message pump,
+// rather than polling it in a separate thread and posting back to the UI
+// thread for every uv iteration.
+const base::Feature kNodeMessagePumpIntegration{
+    "NodeMessagePumpIntegration", base::FEATURE_DISABLED_BY_DEFAULT};
+
+}  // namespace features
+
 namespace electron {
 
 NodeBindingsLinux::NodeBindingsLinux(BrowserEnvironment browser_env)
@@ -24,6 +38,12 @@ void NodeBindingsLinux::RunMessageLoop() {
   uv_loop_->data = this;
   uv_loop_->on_watcher_queue_updated = OnWatcherQueueChanged;
 
+  if (poll_in_message_pump_) {
+    base::CurrentUIThread::Get()->WatchFileDescriptor(
+        uv_backend_fd(uv_loop_), true, base::MessagePumpForUI::WATCH_READ,
+        &backend_fd_controller_, this);
+  }
+
   NodeBindings::RunMessageLoop();
 }
 
@@ -31,6 +51,18 @@ void NodeBindingsLinux::RunMessageLoop() {
 void NodeBindingsLinux::OnWatcherQueueChanged(uv_loop_t* loop) {
   NodeBindingsLinux* self = static_cast<NodeBindingsLinux*>(loop->data);
 
+  if (self->poll_in_message_pump_) {
+    // New watchers are only added to the backend fd when the loop runs, so
+    // run it as soon as we are back in the message loop.
+    if (self->uv_timer_.IsRunning() &&
+        self->uv_timer_.GetCurrentDelay().is_zero())
+      return;
+    self->uv_timer_.Start(FROM_HERE, base::TimeDelta(),
+                          base::BindOnce(&NodeBindingsLinux::UvRunOnce,
+                                         base::Unretained(self)));
+    return;
+  }
+
   // We need to break the io polling in the epoll thread when loop's watcher
   // queue changes, otherwise new events cannot be notified.
   self->WakeupEmbedThread();
@@ -47,6 +79,35 @@ void NodeBindingsLinux::PollEvents() {
   } while (r == -1 && errno == EINTR);
 }
 
+bool NodeBindingsLinux::PollInMessagePump() {
+  // Only the browser process runs node on a thread with a UI message pump.
+  poll_in_message_pump_ =
+      browser_env_ == BrowserEnvironment::kBrowser &&
+      base::FeatureList::IsEnabled(features::kNodeMessagePumpIntegration);
+  return poll_in_message_pump_;
+}
+
+void NodeBindingsLinux::ScheduleUvRun() {
+  // Watchers have been added while running the loop, keep the immediate run
+  // scheduled by OnWatcherQueueChanged.
+  if (uv_timer_.IsRunning() && uv_timer_.GetCurrentDelay().is_zero())
+    return;
+
+  int timeout = uv_backend_timeout(uv_loop_);
+  if (timeout < 0) {
+    uv_timer_.Stop();
+    return;
+  }
+
+  uv_timer_.Start(
+      FROM_HERE, base::Milliseconds(timeout),
+      base::BindOnce(&NodeBindingsLinux::UvRunOnce, base::Unretained(this)));
+}
+
+void NodeBindingsLinux::OnFileCanReadWithoutBlocking(int fd) {
+  UvRunOnce();
+}
+
 // static
 NodeBindings* NodeBindings::Create(BrowserEnvironment browser_env) {
   return new NodeBindingsLinux(browser_env);
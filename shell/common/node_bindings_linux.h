@@ -6,11 +6,14 @@
 #define ELECTRON_SHELL_COMMON_NODE_BINDINGS_LINUX_H_
 
 #include "base/compiler_specific.h"
+#include "base/message_loop/message_pump_for_ui.h"
+#include "base/timer/timer.h"
 #include "shell/common/node_bindings.h"
 
 namespace electron {
 
-class NodeBindingsLinux : public NodeBindings {
+class NodeBindingsLinux : public NodeBindings,
+                          public base::MessagePumpForUI::FdWatcher {
  public:
   explicit NodeBindingsLinux(BrowserEnvironment browser_env);
   ~NodeBindingsLinux() override;
@@ -21,10 +24,26 @@ class NodeBindingsLinux : public NodeBindings {
   // Called when uv's watcher queue changes.
   static void OnWatcherQueueChanged(uv_loop_t* loop);
 
+  // NodeBindings:
   void PollEvents() override;
+  bool PollInMessagePump() override;
+  void ScheduleUvRun() override;
+
+  // base::MessagePumpForUI::FdWatcher:
+  void OnFileCanReadWithoutBlocking(int fd) override;
+  void OnFileCanWriteWithoutBlocking(int fd) override {}
 
   // Epoll to poll for uv's backend fd.
   int epoll_;
+
+  // Whether uv's backend fd is watched by the UI thread's message pump
+  // instead of the embed thread.
+  bool poll_in_message_pump_ = false;
+  base::MessagePumpForUI::FdWatchController backend_fd_controller_{FROM_HERE};
+
+  // Fires when the next uv timer is due, or right away when uv has new
+  // watchers to register.
+  base::OneShotTimer uv_timer_;
 };
 
 }  // namespace electron
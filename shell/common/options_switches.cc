@@ -144,6 +144,9 @@ const char kDisableBlinkFeatures[] = "disableBlinkFeatures";
 // Enable the node integration in WebWorker.
 const char kNodeIntegrationInWorker[] = "nodeIntegrationInWorker";
 
+// Route ipcRenderer.sendTo over direct pipes between renderers.
+const char kDirectSendTo[] = "directSendTo";
+
 // Enable the web view tag.
 const char kWebviewTag[] = "webviewTag";
 
@@ -245,6 +248,9 @@ const char kScrollBounce[] = "scroll-bounce";
 // Command switch passed to renderer process to control nodeIntegration.
 const char kNodeIntegrationInWorker[] = "node-integration-in-worker";
 
+// Command switch passed to renderer process to control directSendTo.
+const char kDirectSendTo[] = "direct-send-to";
+
 // Widevine options
 // Path to Widevine CDM binaries.
 const char kWidevineCdmPath[] = "widevine-cdm-path";
@@ -74,6 +74,7 @@ extern const char kScrollBounce[];
 extern const char kEnableBlinkFeatures[];
 extern const char kDisableBlinkFeatures[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kDirectSendTo[];
 extern const char kWebviewTag[];
 extern const char kCustomArgs[];
 extern const char kPlugins[];
@@ -120,6 +121,7 @@ extern const char kAppPath[];
 
 extern const char kScrollBounce[];
 extern const char kNodeIntegrationInWorker[];
+extern const char kDirectSendTo[];
 
 extern const char kWidevineCdmPath[];
 extern const char kWidevineCdmVersion[];
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <string>
+#include <vector>
 
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
@@ -137,18 +138,26 @@ bool AddImageSkiaRepFromPath(gfx::ImageSkia* image,
 }
 
 bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
-                                   const base::FilePath& path) {
+                                   const base::FilePath& path,
+                                   std::vector<base::FilePath>* loaded_paths) {
+  auto add_rep = [&](const base::FilePath& rep_path, double scale_factor) {
+    if (!AddImageSkiaRepFromPath(image, rep_path, scale_factor))
+      return false;
+    if (loaded_paths)
+      loaded_paths->push_back(rep_path);
+    return true;
+  };
+
   bool succeed = false;
   std::string filename(path.BaseName().RemoveExtension().AsUTF8Unsafe());
   if (base::MatchPattern(filename, "*@*x"))
     // Don't search for other representations if the DPI has been specified.
-    return AddImageSkiaRepFromPath(image, path, GetScaleFactorFromPath(path));
+    return add_rep(path, GetScaleFactorFromPath(path));
   else
-    succeed |= AddImageSkiaRepFromPath(image, path, 1.0f);
+    succeed |= add_rep(path, 1.0f);
 
   for (const ScaleFactorPair& pair : kScaleFactorPairs)
-    succeed |= AddImageSkiaRepFromPath(
-        image, path.InsertBeforeExtensionASCII(pair.name), pair.scale);
+    succeed |= add_rep(path.InsertBeforeExtensionASCII(pair.name), pair.scale);
   return succeed;
 }
 #if BUILDFLAG(IS_WIN)
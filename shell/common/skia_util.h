@@ -5,6 +5,8 @@
 #ifndef ELECTRON_SHELL_COMMON_SKIA_UTIL_H_
 #define ELECTRON_SHELL_COMMON_SKIA_UTIL_H_
 
+#include <vector>
+
 namespace base {
 class FilePath;
 }
@@ -17,8 +19,12 @@ namespace electron {
 
 namespace util {
 
-bool PopulateImageSkiaRepsFromPath(gfx::ImageSkia* image,
-                                   const base::FilePath& path);
+// Adds the representations of |path| and its "@2x"-style variants to |image|,
+// and the files that were read to |loaded_paths| when it is not null.
+bool PopulateImageSkiaRepsFromPath(
+    gfx::ImageSkia* image,
+    const base::FilePath& path,
+    std::vector<base::FilePath>* loaded_paths = nullptr);
 
 bool AddImageSkiaRepFromBuffer(gfx::ImageSkia* image,
                                const unsigned char* data,
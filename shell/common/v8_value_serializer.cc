@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/trace_event/trace_event.h"
 #include "gin/converter.h"
 #include "shell/common/api/electron_api_native_image.h"
 #include "shell/common/gin_helper/microtasks_scope.h"
@@ -199,16 +200,23 @@ class V8Deserializer : public v8::ValueDeserializer::Delegate {
 bool SerializeV8Value(v8::Isolate* isolate,
                       v8::Local<v8::Value> value,
                       blink::CloneableMessage* out) {
-  return V8Serializer(isolate).Serialize(value, out);
+  TRACE_EVENT_BEGIN0("electron", "SerializeV8Value");
+  bool result = V8Serializer(isolate).Serialize(value, out);
+  TRACE_EVENT_END1("electron", "SerializeV8Value", "bytes",
+                   out->encoded_message.size());
+  return result;
 }
 
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         const blink::CloneableMessage& in) {
+  TRACE_EVENT1("electron", "DeserializeV8Value", "bytes",
+               in.encoded_message.size());
   return V8Deserializer(isolate, in).Deserialize();
 }
 
 v8::Local<v8::Value> DeserializeV8Value(v8::Isolate* isolate,
                                         base::span<const uint8_t> data) {
+  TRACE_EVENT1("electron", "DeserializeV8Value", "bytes", data.size());
   return V8Deserializer(isolate, data).Deserialize();
 }
 
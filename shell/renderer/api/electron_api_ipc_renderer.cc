@@ -2,9 +2,12 @@
 // Use of this source code is governed by the MIT license that can be
 // found in the LICENSE file.
 
+#include <map>
 #include <string>
 
+#include "base/command_line.h"
 #include "base/task/post_task.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_frame_observer.h"
@@ -12,6 +15,7 @@
 #include "gin/handle.h"
 #include "gin/object_template_builder.h"
 #include "gin/wrappable.h"
+#include "mojo/public/cpp/bindings/remote.h"
 #include "services/service_manager/public/cpp/interface_provider.h"
 #include "shell/common/api/api.mojom.h"
 #include "shell/common/gin_converters/blink_converter.h"
@@ -19,8 +23,10 @@
 #include "shell/common/gin_helper/error_thrower.h"
 #include "shell/common/gin_helper/function_template_extensions.h"
 #include "shell/common/gin_helper/promise.h"
+#include "shell/common/ipc_channel_metrics.h"
 #include "shell/common/node_bindings.h"
 #include "shell/common/node_includes.h"
+#include "shell/common/options_switches.h"
 #include "shell/common/v8_value_serializer.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
 #include "third_party/blink/public/web/web_local_frame.h"
@@ -52,7 +58,9 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
   }
 
   explicit IPCRenderer(v8::Isolate* isolate)
-      : content::RenderFrameObserver(GetCurrentRenderFrame()) {
+      : content::RenderFrameObserver(GetCurrentRenderFrame()),
+        direct_send_to_(base::CommandLine::ForCurrentProcess()->HasSwitch(
+            electron::switches::kDirectSendTo)) {
     RenderFrame* render_frame = GetCurrentRenderFrame();
     DCHECK(render_frame);
     weak_context_ =
@@ -63,13 +71,20 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
         &electron_browser_remote_);
   }
 
-  void OnDestruct() override { electron_browser_remote_.reset(); }
+  void OnDestruct() override {
+    electron_browser_remote_.reset();
+    channel_ids_.clear();
+    message_targets_.clear();
+  }
 
   void WillReleaseScriptContext(v8::Local<v8::Context> context,
                                 int32_t world_id) override {
     if (weak_context_.IsEmpty() ||
-        weak_context_.Get(context->GetIsolate()) == context)
+        weak_context_.Get(context->GetIsolate()) == context) {
       electron_browser_remote_.reset();
+      channel_ids_.clear();
+      message_targets_.clear();
+    }
   }
 
   // gin::Wrappable:
@@ -87,6 +102,38 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
   const char* GetTypeName() override { return "IPCRenderer"; }
 
  private:
+  // Serializes |arguments| and records the cost in the metrics of |channel|.
+  bool SerializeMessage(v8::Isolate* isolate,
+                        const std::string& channel,
+                        v8::Local<v8::Value> arguments,
+                        blink::CloneableMessage* message) {
+    base::TimeTicks start = base::TimeTicks::Now();
+    if (!electron::SerializeV8Value(isolate, arguments, message))
+      return false;
+    electron::IPCChannelMetrics::GetInstance()->RecordSent(
+        channel, message->encoded_message.size(),
+        base::TimeTicks::Now() - start);
+    return true;
+  }
+
+  // Gets the compact ID of |channel|, registering it with the browser the
+  // first time the channel is used on this connection. Returns false once
+  // the connection has no IDs left, the channel must then be sent by name.
+  bool GetChannelId(const std::string& channel, uint32_t* channel_id) {
+    auto it = channel_ids_.find(channel);
+    if (it != channel_ids_.end()) {
+      *channel_id = it->second;
+      return true;
+    }
+    if (channel_ids_.size() >=
+        electron::mojom::ElectronBrowser::kMaxRegisteredChannels)
+      return false;
+    *channel_id = channel_ids_.size();
+    channel_ids_.emplace(channel, *channel_id);
+    electron_browser_remote_->RegisterChannel(*channel_id, channel);
+    return true;
+  }
+
   void SendMessage(v8::Isolate* isolate,
                    gin_helper::ErrorThrower thrower,
                    bool internal,
@@ -97,10 +144,16 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
       return;
     }
     blink::CloneableMessage message;
-    if (!electron::SerializeV8Value(isolate, arguments, &message)) {
+    if (!SerializeMessage(isolate, channel, arguments, &message)) {
       return;
     }
-    electron_browser_remote_->Message(internal, channel, std::move(message));
+    uint32_t channel_id;
+    if (GetChannelId(channel, &channel_id)) {
+      electron_browser_remote_->MessageWithChannelId(internal, channel_id,
+                                                     std::move(message));
+    } else {
+      electron_browser_remote_->Message(internal, channel, std::move(message));
+    }
   }
 
   v8::Local<v8::Promise> Invoke(v8::Isolate* isolate,
@@ -113,18 +166,24 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
       return v8::Local<v8::Promise>();
     }
     blink::CloneableMessage message;
-    if (!electron::SerializeV8Value(isolate, arguments, &message)) {
+    if (!SerializeMessage(isolate, channel, arguments, &message)) {
       return v8::Local<v8::Promise>();
     }
     gin_helper::Promise<blink::CloneableMessage> p(isolate);
     auto handle = p.GetHandle();
 
-    electron_browser_remote_->Invoke(
-        internal, channel, std::move(message),
-        base::BindOnce(
-            [](gin_helper::Promise<blink::CloneableMessage> p,
-               blink::CloneableMessage result) { p.Resolve(result); },
-            std::move(p)));
+    auto callback = base::BindOnce(
+        [](gin_helper::Promise<blink::CloneableMessage> p,
+           blink::CloneableMessage result) { p.Resolve(result); },
+        std::move(p));
+    uint32_t channel_id;
+    if (GetChannelId(channel, &channel_id)) {
+      electron_browser_remote_->InvokeWithChannelId(
+          internal, channel_id, std::move(message), std::move(callback));
+    } else {
+      electron_browser_remote_->Invoke(internal, channel, std::move(message),
+                                       std::move(callback));
+    }
 
     return handle;
   }
@@ -180,13 +239,39 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
       return;
     }
     blink::CloneableMessage message;
-    if (!electron::SerializeV8Value(isolate, arguments, &message)) {
+    if (!SerializeMessage(isolate, channel, arguments, &message)) {
+      return;
+    }
+    if (direct_send_to_) {
+      GetMessageTarget(web_contents_id)->Message(channel, std::move(message));
       return;
     }
     electron_browser_remote_->MessageTo(web_contents_id, channel,
                                         std::move(message));
   }
 
+  // Returns the direct pipe to the WebContents |web_contents_id|, asking the
+  // browser to set it up on first use. Messages sent before the browser has
+  // handed the other end to the target are queued in the pipe.
+  mojo::Remote<electron::mojom::ElectronMessageTarget>& GetMessageTarget(
+      int32_t web_contents_id) {
+    auto& target = message_targets_[web_contents_id];
+    if (!target.is_bound()) {
+      electron_browser_remote_->ConnectMessageTo(
+          web_contents_id, target.BindNewPipeAndPassReceiver());
+      // The pipe is closed when the target goes away or navigates to another
+      // process, reconnect on the next message.
+      target.set_disconnect_handler(
+          base::BindOnce(&IPCRenderer::OnMessageTargetDisconnected,
+                         base::Unretained(this), web_contents_id));
+    }
+    return target;
+  }
+
+  void OnMessageTargetDisconnected(int32_t web_contents_id) {
+    message_targets_.erase(web_contents_id);
+  }
+
   void SendToHost(v8::Isolate* isolate,
                   gin_helper::ErrorThrower thrower,
                   const std::string& channel,
@@ -196,7 +281,7 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
       return;
     }
     blink::CloneableMessage message;
-    if (!electron::SerializeV8Value(isolate, arguments, &message)) {
+    if (!SerializeMessage(isolate, channel, arguments, &message)) {
       return;
     }
     electron_browser_remote_->MessageHost(channel, std::move(message));
@@ -212,7 +297,7 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
       return v8::Local<v8::Value>();
     }
     blink::CloneableMessage message;
-    if (!electron::SerializeV8Value(isolate, arguments, &message)) {
+    if (!SerializeMessage(isolate, channel, arguments, &message)) {
       return v8::Local<v8::Value>();
     }
 
@@ -225,6 +310,12 @@ class IPCRenderer : public gin::Wrappable<IPCRenderer>,
   v8::Global<v8::Context> weak_context_;
   mojo::AssociatedRemote<electron::mojom::ElectronBrowser>
       electron_browser_remote_;
+  // Channels registered on |electron_browser_remote_|, at most
+  // ElectronBrowser::kMaxRegisteredChannels.
+  std::map<std::string, uint32_t> channel_ids_;
+  const bool direct_send_to_;
+  std::map<int32_t, mojo::Remote<electron::mojom::ElectronMessageTarget>>
+      message_targets_;
 };
 
 gin::WrapperInfo IPCRenderer::kWrapperInfo = {gin::kEmbedderNativeGin};
@@ -13,6 +13,7 @@
 #include "base/logging.h"
 #include "base/numerics/safe_conversions.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/trace_event/trace_event.h"
 #include "components/spellcheck/renderer/spellcheck_worditerator.h"
 #include "shell/common/gin_helper/dictionary.h"
 #include "shell/common/gin_helper/function_template.h"
@@ -27,6 +28,12 @@ namespace api {
 
 namespace {
 
+// Enough for the vocabulary of a long document.
+constexpr size_t kWordCacheSize = 4096;
+
+// How long a word sent to the provider is waited for before it is sent again.
+constexpr base::TimeDelta kInFlightTimeout = base::Seconds(1);
+
 bool HasWordCharacters(const std::u16string& text, int index) {
   const char16_t* data = text.data();
   int length = text.length();
@@ -61,10 +68,15 @@ class SpellCheckClient::SpellcheckRequest {
   const std::u16string& text() const { return text_; }
   blink::WebTextCheckingCompletion* completion() { return completion_.get(); }
   std::vector<Word>& wordlist() { return word_list_; }
+  std::unordered_set<std::u16string>& misspelled() { return misspelled_; }
+  std::unordered_set<std::u16string>& unchecked() { return unchecked_; }
 
  private:
   std::u16string text_;          // Text to be checked in this task.
   std::vector<Word> word_list_;  // List of Words found in text
+  std::unordered_set<std::u16string> misspelled_;  // Misspelled words in text
+  // Words in text the provider has not answered for yet.
+  std::unordered_set<std::u16string> unchecked_;
   // The interface to send the misspelled ranges to WebKit.
   std::unique_ptr<blink::WebTextCheckingCompletion> completion_;
 };
@@ -72,7 +84,8 @@ class SpellCheckClient::SpellcheckRequest {
 SpellCheckClient::SpellCheckClient(const std::string& language,
                                    v8::Isolate* isolate,
                                    v8::Local<v8::Object> provider)
-    : isolate_(isolate),
+    : word_cache_(kWordCacheSize),
+      isolate_(isolate),
       context_(isolate, isolate->GetCurrentContext()),
       provider_(isolate, provider) {
   DCHECK(!context_.IsEmpty());
@@ -112,6 +125,19 @@ void SpellCheckClient::RequestCheckingOfText(
       base::BindOnce(&SpellCheckClient::SpellCheckText, AsWeakPtr()));
 }
 
+void SpellCheckClient::ClearCache() {
+  word_cache_.Clear();
+  in_flight_words_.clear();
+  resend_timer_.Stop();
+  cache_generation_++;
+  // The pending request may be waiting for answers that are now ignored,
+  // WebKit requests the text again when it is edited.
+  if (pending_request_param_) {
+    pending_request_param_->completion()->DidCancelCheckingText();
+    pending_request_param_ = nullptr;
+  }
+}
+
 bool SpellCheckClient::IsSpellCheckingEnabled() const {
   return true;
 }
@@ -126,6 +152,10 @@ void SpellCheckClient::UpdateSpellingUIWithMisspelledWord(
     const blink::WebString& word) {}
 
 void SpellCheckClient::SpellCheckText() {
+  // The request may have been cancelled by ClearCache() since this was posted.
+  if (!pending_request_param_)
+    return;
+
   const auto& text = pending_request_param_->text();
   if (text.empty() || spell_check_.IsEmpty()) {
     pending_request_param_->completion()->DidCancelCheckingText();
@@ -180,16 +210,89 @@ void SpellCheckClient::SpellCheckText() {
     }
   }
 
+  // Only the words that have not been checked before go to the provider, and
+  // those it is still checking are waited for instead of being sent again.
+  auto& misspelled = pending_request_param_->misspelled();
+  auto& unchecked = pending_request_param_->unchecked();
+  const base::TimeTicks now = base::TimeTicks::Now();
+  std::set<std::u16string> words_to_check;
+  for (const auto& w : words) {
+    auto cached = word_cache_.Get(w);
+    if (cached != word_cache_.end()) {
+      if (cached->second)
+        misspelled.insert(w);
+      continue;
+    }
+    unchecked.insert(w);
+    auto in_flight = in_flight_words_.find(w);
+    if (in_flight == in_flight_words_.end() ||
+        now - in_flight->second >= kInFlightTimeout) {
+      in_flight_words_[w] = now;
+      words_to_check.insert(w);
+    }
+  }
+
+  if (unchecked.empty()) {
+    FinishPendingRequest();
+    return;
+  }
+
+  resend_timer_.Start(FROM_HERE, kInFlightTimeout,
+                      base::BindOnce(&SpellCheckClient::ResendUncheckedWords,
+                                     base::Unretained(this)));
+
   // Send out all the words data to the spellchecker to check
-  SpellCheckWords(scope, words);
+  if (!words_to_check.empty())
+    SpellCheckWords(scope, std::move(words_to_check));
+}
+
+void SpellCheckClient::ResendUncheckedWords() {
+  if (!pending_request_param_ || spell_check_.IsEmpty())
+    return;
+  const auto& unchecked = pending_request_param_->unchecked();
+  if (unchecked.empty())
+    return;
+
+  SpellCheckScope scope(*this);
+  const base::TimeTicks now = base::TimeTicks::Now();
+  std::set<std::u16string> words(unchecked.begin(), unchecked.end());
+  for (const auto& w : words)
+    in_flight_words_[w] = now;
+  SpellCheckWords(scope, std::move(words));
 }
 
 void SpellCheckClient::OnSpellCheckDone(
+    int generation,
+    const std::set<std::u16string>& checked_words,
     const std::vector<std::u16string>& misspelled_words) {
-  std::vector<blink::WebTextCheckingResult> results;
+  if (generation != cache_generation_)
+    return;
+
   std::unordered_set<std::u16string> misspelled(misspelled_words.begin(),
                                                 misspelled_words.end());
+  for (const auto& word : checked_words) {
+    in_flight_words_.erase(word);
+    word_cache_.Put(word, misspelled.find(word) != misspelled.end());
+  }
 
+  // The answer may be for words of an earlier request that the pending one
+  // is waiting for too.
+  if (!pending_request_param_)
+    return;
+  auto& unchecked = pending_request_param_->unchecked();
+  if (unchecked.empty())
+    return;
+  for (const auto& word : checked_words) {
+    if (unchecked.erase(word) && misspelled.find(word) != misspelled.end())
+      pending_request_param_->misspelled().insert(word);
+  }
+  if (unchecked.empty())
+    FinishPendingRequest();
+}
+
+void SpellCheckClient::FinishPendingRequest() {
+  std::vector<blink::WebTextCheckingResult> results;
+  const auto& misspelled = pending_request_param_->misspelled();
   auto& word_list = pending_request_param_->wordlist();
 
   for (const auto& word : word_list) {
@@ -212,24 +315,42 @@ void SpellCheckClient::OnSpellCheckDone(
   }
   pending_request_param_->completion()->DidFinishCheckingText(results);
   pending_request_param_ = nullptr;
+  resend_timer_.Stop();
 }
 
 void SpellCheckClient::SpellCheckWords(const SpellCheckScope& scope,
-                                       const std::set<std::u16string>& words) {
+                                       std::set<std::u16string> words) {
   DCHECK(!scope.spell_check_.IsEmpty());
+  TRACE_EVENT1("electron", "SpellCheckClient::SpellCheckWords", "words",
+               words.size());
 
   gin_helper::MicrotasksScope microtasks_scope(
       isolate_, v8::MicrotasksScope::kDoNotRunMicrotasks);
 
+  v8::Local<v8::Value> words_value = gin::ConvertToV8(isolate_, words);
   v8::Local<v8::FunctionTemplate> templ = gin_helper::CreateFunctionTemplate(
-      isolate_,
-      base::BindRepeating(&SpellCheckClient::OnSpellCheckDone, AsWeakPtr()));
+      isolate_, base::BindRepeating(&SpellCheckClient::OnSpellCheckDone,
+                                    AsWeakPtr(), cache_generation_, words));
 
   auto context = isolate_->GetCurrentContext();
-  v8::Local<v8::Value> args[] = {gin::ConvertToV8(isolate_, words),
+  v8::Local<v8::Value> args[] = {words_value,
                                  templ->GetFunction(context).ToLocalChecked()};
   // Call javascript with the words and the callback function
-  scope.spell_check_->Call(context, scope.provider_, 2, args).IsEmpty();
+  if (!scope.spell_check_->Call(context, scope.provider_, 2, args).IsEmpty())
+    return;
+
+  // The provider threw, so no answer is coming for these words.
+  for (const auto& word : words)
+    in_flight_words_.erase(word);
+  if (!pending_request_param_)
+    return;
+  auto& unchecked = pending_request_param_->unchecked();
+  if (unchecked.empty())
+    return;
+  for (const auto& word : words)
+    unchecked.erase(word);
+  if (unchecked.empty())
+    FinishPendingRequest();
 }
 
 // Returns whether or not the given string is a contraction.
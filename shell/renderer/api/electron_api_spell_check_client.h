@@ -5,13 +5,17 @@
 #ifndef ELECTRON_SHELL_RENDERER_API_ELECTRON_API_SPELL_CHECK_CLIENT_H_
 #define ELECTRON_SHELL_RENDERER_API_ELECTRON_API_SPELL_CHECK_CLIENT_H_
 
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "base/callback.h"
+#include "base/containers/lru_cache.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 #include "components/spellcheck/renderer/spellcheck_worditerator.h"
 #include "third_party/blink/public/platform/web_spell_check_panel_host_client.h"
 #include "third_party/blink/public/platform/web_vector.h"
@@ -40,6 +44,10 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
   SpellCheckClient(const SpellCheckClient&) = delete;
   SpellCheckClient& operator=(const SpellCheckClient&) = delete;
 
+  // Forgets the results of the provider, so every word is checked again, and
+  // cancels the pending request.
+  void ClearCache();
+
  private:
   class SpellcheckRequest;
   // blink::WebTextCheckClient:
@@ -71,9 +79,14 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
 
   // Call JavaScript to check spelling a word.
   // The javascript function will callback OnSpellCheckDone
-  // with the results of all the misspelled words.
+  // with the results of all the misspelled words. If the call fails the
+  // words are treated as correctly spelled by the pending request.
   void SpellCheckWords(const SpellCheckScope& scope,
-                       const std::set<std::u16string>& words);
+                       std::set<std::u16string> words);
+
+  // Sends the words the pending request is still waiting for to the provider
+  // again, in case the earlier call for them never gets an answer.
+  void ResendUncheckedWords();
 
   // Returns whether or not the given word is a contraction of valid words
   // (e.g. "word:word").
@@ -83,8 +96,15 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
                      const std::u16string& contraction,
                      std::vector<std::u16string>* contraction_words);
 
-  // Callback for the JS API which returns the list of misspelled words.
-  void OnSpellCheckDone(const std::vector<std::u16string>& misspelled_words);
+  // Callback for the JS API which returns the list of misspelled words
+  // among |checked_words|. Answers given before the cache was cleared in
+  // |generation| are ignored.
+  void OnSpellCheckDone(int generation,
+                        const std::set<std::u16string>& checked_words,
+                        const std::vector<std::u16string>& misspelled_words);
+
+  // Sends the misspelled ranges of the pending request to WebKit.
+  void FinishPendingRequest();
 
   // Represents character attributes used for filtering out characters which
   // are not supported by this SpellCheck object.
@@ -103,6 +123,18 @@ class SpellCheckClient : public blink::WebSpellCheckPanelHostClient,
   // requests so we do not have to use vectors.)
   std::unique_ptr<SpellcheckRequest> pending_request_param_;
 
+  // Whether each word the provider has checked is misspelled, so editing a
+  // long text only sends the new words to JavaScript. A client is created
+  // for every language and provider, which resets the cache.
+  base::HashingLRUCache<std::u16string, bool> word_cache_;
+  // Words sent to the provider that it has not answered yet, with the time
+  // they were sent, so requests made while it is busy do not send them again.
+  std::map<std::u16string, base::TimeTicks> in_flight_words_;
+  // Bounds how long the pending request waits for in-flight words.
+  base::OneShotTimer resend_timer_;
+  // Incremented by ClearCache().
+  int cache_generation_ = 0;
+
   v8::Isolate* isolate_;
   v8::Global<v8::Context> context_;
   v8::Global<v8::Object> provider_;
@@ -302,6 +302,8 @@ class SpellCheckerHolder final : public content::RenderFrameObserver {
 
   ~SpellCheckerHolder() final { instances_.erase(this); }
 
+  SpellCheckClient* spell_check_client() { return spell_check_client_.get(); }
+
   void UnsetAndDestroy() {
     FrameSetSpellChecker set_spell_checker(nullptr, render_frame());
     delete this;
@@ -385,6 +387,8 @@ class WebFrameRenderer : public gin::Wrappable<WebFrameRenderer>,
         .SetMethod("clearCache", &WebFrameRenderer::ClearCache)
         .SetMethod("setSpellCheckProvider",
                    &WebFrameRenderer::SetSpellCheckProvider)
+        .SetMethod("clearSpellCheckCache",
+                   &WebFrameRenderer::ClearSpellCheckCache)
         // Frame navigators
         .SetMethod("findFrameByRoutingId",
                    &WebFrameRenderer::FindFrameByRoutingId)
@@ -592,6 +596,16 @@ class WebFrameRenderer : public gin::Wrappable<WebFrameRenderer>,
     new SpellCheckerHolder(render_frame, std::move(spell_check_client));
   }
 
+  void ClearSpellCheckCache(v8::Isolate* isolate) {
+    content::RenderFrame* render_frame;
+    if (!MaybeGetRenderFrame(isolate, "clearSpellCheckCache", &render_frame))
+      return;
+
+    auto* holder = SpellCheckerHolder::FromRenderFrame(render_frame);
+    if (holder)
+      holder->spell_check_client()->ClearCache();
+  }
+
   void InsertText(v8::Isolate* isolate, const std::string& text) {
     content::RenderFrame* render_frame;
     if (!MaybeGetRenderFrame(isolate, "insertText", &render_frame))
@@ -17,6 +17,7 @@
 #include "shell/common/gin_converters/blink_converter.h"
 #include "shell/common/gin_converters/value_converter.h"
 #include "shell/common/heap_snapshot.h"
+#include "shell/common/ipc_channel_metrics.h"
 #include "shell/common/node_includes.h"
 #include "shell/common/options_switches.h"
 #include "shell/common/v8_value_serializer.h"
@@ -142,6 +143,11 @@ void ElectronApiServiceImpl::DidCreateDocumentElement() {
     receiver_.set_disconnect_handler(base::BindOnce(
         &ElectronApiServiceImpl::OnConnectionError, GetWeakPtr()));
   }
+
+  for (auto& target : pending_message_targets_)
+    message_target_receivers_.Add(this, std::move(target.second),
+                                  target.first);
+  pending_message_targets_.clear();
 }
 
 void ElectronApiServiceImpl::OnDestruct() {
@@ -167,11 +173,29 @@ void ElectronApiServiceImpl::Message(bool internal,
   v8::Local<v8::Context> context = renderer_client_->GetContext(frame, isolate);
   v8::Context::Scope context_scope(context);
 
+  ScopedIPCChannelReceive metrics(channel, arguments.encoded_message.size());
   v8::Local<v8::Value> args = gin::ConvertToV8(isolate, arguments);
 
   EmitIPCEvent(context, internal, channel, {}, args, sender_id);
 }
 
+void ElectronApiServiceImpl::BindMessageTarget(
+    int32_t sender_id,
+    mojo::PendingReceiver<mojom::ElectronMessageTarget> receiver) {
+  if (document_created_)
+    message_target_receivers_.Add(this, std::move(receiver), sender_id);
+  else
+    pending_message_targets_.emplace_back(sender_id, std::move(receiver));
+}
+
+void ElectronApiServiceImpl::Message(const std::string& channel,
+                                     blink::CloneableMessage arguments) {
+  TRACE_EVENT1("electron", "ElectronApiServiceImpl::Message", "channel",
+               channel);
+  Message(false /* internal */, channel, std::move(arguments),
+          message_target_receivers_.current_context());
+}
+
 void ElectronApiServiceImpl::ReceivePostMessage(
     const std::string& channel,
     blink::TransferableMessage message) {
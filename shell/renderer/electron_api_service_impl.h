@@ -6,6 +6,8 @@
 #define ELECTRON_SHELL_RENDERER_ELECTRON_API_SERVICE_IMPL_H_
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "base/memory/weak_ptr.h"
 #include "content/public/renderer/render_frame.h"
@@ -14,12 +16,14 @@
 #include "electron/shell/common/api/api.mojom.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
 #include "mojo/public/cpp/bindings/receiver.h"
+#include "mojo/public/cpp/bindings/receiver_set.h"
 
 namespace electron {
 
 class RendererClientBase;
 
 class ElectronApiServiceImpl : public mojom::ElectronRenderer,
+                               public mojom::ElectronMessageTarget,
                                public content::RenderFrameObserver {
  public:
   ElectronApiServiceImpl(content::RenderFrame* render_frame,
@@ -36,12 +40,19 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
                const std::string& channel,
                blink::CloneableMessage arguments,
                int32_t sender_id) override;
+  void BindMessageTarget(
+      int32_t sender_id,
+      mojo::PendingReceiver<mojom::ElectronMessageTarget> receiver) override;
   void ReceivePostMessage(const std::string& channel,
                           blink::TransferableMessage message) override;
   void TakeHeapSnapshot(mojo::ScopedHandle file,
                         TakeHeapSnapshotCallback callback) override;
   void ProcessPendingMessages();
 
+  // mojom::ElectronMessageTarget
+  void Message(const std::string& channel,
+               blink::CloneableMessage arguments) override;
+
   base::WeakPtr<ElectronApiServiceImpl> GetWeakPtr() {
     return weak_factory_.GetWeakPtr();
   }
@@ -64,6 +75,14 @@ class ElectronApiServiceImpl : public mojom::ElectronRenderer,
   mojo::PendingReceiver<mojom::ElectronRenderer> pending_receiver_;
   mojo::Receiver<mojom::ElectronRenderer> receiver_{this};
 
+  // Direct pipes from other renderers, the context is the sender's
+  // WebContents ID.
+  std::vector<std::pair<int32_t,
+                        mojo::PendingReceiver<mojom::ElectronMessageTarget>>>
+      pending_message_targets_;
+  mojo::ReceiverSet<mojom::ElectronMessageTarget, int32_t>
+      message_target_receivers_;
+
   RendererClientBase* renderer_client_;
   base::WeakPtrFactory<ElectronApiServiceImpl> weak_factory_{this};
 };
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/command_line.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/trace_event/trace_event.h"
@@ -24,6 +25,7 @@
 #include "shell/renderer/renderer_client_base.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
 #include "third_party/blink/public/common/web_preferences/web_preferences.h"
+#include "third_party/blink/public/platform/task_type.h"
 #include "third_party/blink/public/platform/web_isolated_world_info.h"
 #include "third_party/blink/public/web/blink.h"
 #include "third_party/blink/public/web/web_document.h"
@@ -138,20 +140,56 @@ void ElectronRenderFrameObserver::DidInstallConditionalFeatures(
 }
 
 void ElectronRenderFrameObserver::DraggableRegionsChanged() {
+  // Animated app regions notify on every layout, only read the regions once
+  // per task.
+  ++draggable_regions_changed_count_;
+  if (draggable_regions_update_pending_)
+    return;
+  draggable_regions_update_pending_ = true;
+  render_frame_->GetTaskRunner(blink::TaskType::kInternalDefault)
+      ->PostTask(
+          FROM_HERE,
+          base::BindOnce(&ElectronRenderFrameObserver::SendDraggableRegions,
+                         weak_factory_.GetWeakPtr()));
+}
+
+void ElectronRenderFrameObserver::SendDraggableRegions() {
+  draggable_regions_update_pending_ = false;
   blink::WebVector<blink::WebDraggableRegion> webregions =
       render_frame_->GetWebFrame()->GetDocument().DraggableRegions();
-  std::vector<mojom::DraggableRegionPtr> regions;
+  DraggableRegions current;
+  current.reserve(webregions.size());
   for (auto& webregion : webregions) {
-    auto region = mojom::DraggableRegion::New();
     render_frame_->ConvertViewportToWindow(&webregion.bounds);
-    region->bounds = webregion.bounds;
-    region->draggable = webregion.draggable;
+    current.emplace_back(webregion.bounds, webregion.draggable);
+  }
+
+  TRACE_COUNTER2("electron", "ElectronRenderFrameObserver::DraggableRegions",
+                 "changed", draggable_regions_changed_count_, "sent",
+                 draggable_regions_sent_count_);
+  if (last_draggable_regions_ == current)
+    return;
+
+  std::vector<mojom::DraggableRegionPtr> regions;
+  regions.reserve(current.size());
+  for (const auto& entry : current) {
+    auto region = mojom::DraggableRegion::New();
+    region->bounds = entry.first;
+    region->draggable = entry.second;
     regions.push_back(std::move(region));
   }
+  last_draggable_regions_ = std::move(current);
+  ++draggable_regions_sent_count_;
+  GetBrowserRemote()->UpdateDraggableRegions(std::move(regions));
+}
 
-  mojo::AssociatedRemote<mojom::ElectronBrowser> browser_remote;
-  render_frame_->GetRemoteAssociatedInterfaces()->GetInterface(&browser_remote);
-  browser_remote->UpdateDraggableRegions(std::move(regions));
+mojom::ElectronBrowser* ElectronRenderFrameObserver::GetBrowserRemote() {
+  if (!browser_remote_) {
+    render_frame_->GetRemoteAssociatedInterfaces()->GetInterface(
+        &browser_remote_);
+    browser_remote_.reset_on_disconnect();
+  }
+  return browser_remote_.get();
 }
 
 void ElectronRenderFrameObserver::WillReleaseScriptContext(
@@ -167,12 +205,8 @@ void ElectronRenderFrameObserver::OnDestruct() {
 
 void ElectronRenderFrameObserver::DidMeaningfulLayout(
     blink::WebMeaningfulLayout layout_type) {
-  if (layout_type == blink::WebMeaningfulLayout::kVisuallyNonEmpty) {
-    mojo::AssociatedRemote<mojom::ElectronBrowser> browser_remote;
-    render_frame_->GetRemoteAssociatedInterfaces()->GetInterface(
-        &browser_remote);
-    browser_remote->OnFirstNonEmptyLayout();
-  }
+  if (layout_type == blink::WebMeaningfulLayout::kVisuallyNonEmpty)
+    GetBrowserRemote()->OnFirstNonEmptyLayout();
 }
 
 void ElectronRenderFrameObserver::CreateIsolatedWorldContext() {
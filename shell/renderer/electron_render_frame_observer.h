@@ -6,10 +6,17 @@
 #define ELECTRON_SHELL_RENDERER_ELECTRON_RENDER_FRAME_OBSERVER_H_
 
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/memory/weak_ptr.h"
 #include "content/public/renderer/render_frame_observer.h"
+#include "electron/shell/common/api/api.mojom.h"
 #include "ipc/ipc_platform_file.h"
+#include "mojo/public/cpp/bindings/associated_remote.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "third_party/blink/public/web/web_local_frame.h"
+#include "ui/gfx/geometry/rect.h"
 
 namespace electron {
 
@@ -43,10 +50,24 @@ class ElectronRenderFrameObserver : public content::RenderFrameObserver {
   bool IsIsolatedWorld(int world_id);
   void OnTakeHeapSnapshot(IPC::PlatformFileForTransit file_handle,
                           const std::string& channel);
+  mojom::ElectronBrowser* GetBrowserRemote();
+  void SendDraggableRegions();
 
   bool has_delayed_node_initialization_ = false;
   content::RenderFrame* render_frame_;
   RendererClientBase* renderer_client_;
+
+  mojo::AssociatedRemote<mojom::ElectronBrowser> browser_remote_;
+
+  // Draggable region changes are coalesced into one update per task, and the
+  // update is dropped when the regions are the same as the last ones sent.
+  using DraggableRegions = std::vector<std::pair<gfx::Rect, bool>>;
+  bool draggable_regions_update_pending_ = false;
+  absl::optional<DraggableRegions> last_draggable_regions_;
+  uint64_t draggable_regions_changed_count_ = 0;
+  uint64_t draggable_regions_sent_count_ = 0;
+
+  base::WeakPtrFactory<ElectronRenderFrameObserver> weak_factory_{this};
 };
 
 }  // namespace electron
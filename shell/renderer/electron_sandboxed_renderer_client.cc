@@ -4,15 +4,22 @@
 
 #include "shell/renderer/electron_sandboxed_renderer_client.h"
 
+#include <memory>
+#include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "base/base_paths.h"
 #include "base/command_line.h"
+#include "base/containers/lru_cache.h"
 #include "base/files/file_path.h"
+#include "base/hash/sha1.h"
+#include "base/no_destructor.h"
 #include "base/path_service.h"
 #include "base/process/process_handle.h"
 #include "base/process/process_metrics.h"
+#include "base/trace_event/trace_event.h"
 #include "content/public/renderer/render_frame.h"
 #include "electron/buildflags/buildflags.h"
 #include "shell/common/api/electron_bindings.h"
@@ -89,13 +96,77 @@ v8::Local<v8::Value> GetBinding(v8::Isolate* isolate,
   return exports;
 }
 
+// Preload scripts rarely change during the lifetime of a renderer process, but
+// they are compiled again for every frame and every reload. Keep the V8 code
+// cache of the most recently used ones, keyed by a hash of their source.
+const size_t kMaxPreloadCodeCacheEntries = 8;
+
+struct PreloadCodeCache {
+  base::LRUCache<std::string, std::vector<uint8_t>> entries{
+      kMaxPreloadCodeCacheEntries};
+  // Compiles that consumed the code cache, and those that did not.
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+};
+
+PreloadCodeCache& GetPreloadCodeCache() {
+  static base::NoDestructor<PreloadCodeCache> code_cache;
+  return *code_cache;
+}
+
+v8::Local<v8::Value> GetPreloadCodeCacheStats(v8::Isolate* isolate) {
+  const PreloadCodeCache& code_cache = GetPreloadCodeCache();
+  gin_helper::Dictionary dict = gin::Dictionary::CreateEmpty(isolate);
+  dict.SetHidden("simple", true);
+  dict.Set("hits", code_cache.hits);
+  dict.Set("misses", code_cache.misses);
+  dict.Set("count", static_cast<uint64_t>(code_cache.entries.size()));
+  return dict.GetHandle();
+}
+
 v8::Local<v8::Value> CreatePreloadScript(v8::Isolate* isolate,
                                          v8::Local<v8::String> source) {
   auto context = isolate->GetCurrentContext();
-  auto maybe_script = v8::Script::Compile(context, source);
+  std::string source_hash =
+      base::SHA1HashString(gin::V8ToString(isolate, source));
+
+  PreloadCodeCache& code_cache = GetPreloadCodeCache();
+  auto cached = code_cache.entries.Get(source_hash);
+  v8::ScriptCompiler::CompileOptions options =
+      v8::ScriptCompiler::kNoCompileOptions;
+  v8::ScriptCompiler::CachedData* cached_data = nullptr;
+  if (cached != code_cache.entries.end()) {
+    // Owned by |script_source|, the buffer is not copied.
+    cached_data = new v8::ScriptCompiler::CachedData(
+        cached->second.data(), cached->second.size());
+    options = v8::ScriptCompiler::kConsumeCodeCache;
+  }
+
+  v8::ScriptCompiler::Source script_source(source, cached_data);
   v8::Local<v8::Script> script;
-  if (!maybe_script.ToLocal(&script))
-    return v8::Local<v8::Value>();
+  {
+    TRACE_EVENT1("electron", "CreatePreloadScript", "code_cache",
+                 cached_data ? "hit" : "miss");
+    if (!v8::ScriptCompiler::Compile(context, &script_source, options)
+             .ToLocal(&script))
+      return v8::Local<v8::Value>();
+  }
+
+  if (cached_data && !cached_data->rejected) {
+    code_cache.hits++;
+  } else {
+    code_cache.misses++;
+    std::unique_ptr<v8::ScriptCompiler::CachedData> new_cache(
+        v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    // Replaces a rejected entry, or evicts the least recently used one.
+    if (new_cache) {
+      code_cache.entries.Put(
+          std::move(source_hash),
+          std::vector<uint8_t>(new_cache->data,
+                               new_cache->data + new_cache->length));
+    }
+  }
+
   return script->Run(context).ToLocalChecked();
 }
 
@@ -153,6 +224,7 @@ void ElectronSandboxedRendererClient::InitializeBindings(
   BindProcess(isolate, &process, render_frame);
 
   process.SetMethod("uptime", Uptime);
+  process.SetMethod("getPreloadCodeCacheStats", GetPreloadCodeCacheStats);
   process.Set("argv", base::CommandLine::ForCurrentProcess()->argv());
   process.SetReadOnly("pid", base::GetCurrentProcId());
   process.SetReadOnly("sandboxed", true);
@@ -1347,9 +1347,18 @@ describe('app module', () => {
     });
   });
 
+  describe('getStartupTimings() API', () => {
+    it('returns the bootstrap phases in order', () => {
+      const timings = app.getStartupTimings();
+      expect(timings.bootstrapStarted).to.be.above(0);
+      expect(timings.jsEnvironmentCreated).to.be.at.least(0);
+      expect(timings.nodeEnvironmentCreated).to.be.at.least(timings.jsEnvironmentCreated);
+      expect(timings.nodeEnvironmentLoaded).to.be.at.least(timings.nodeEnvironmentCreated);
+    });
+  });
+
   describe('getAppMetrics() API', () => {
-    it('returns memory and cpu stats of all running electron processes', () => {
-      const appMetrics = app.getAppMetrics();
+    const checkAppMetrics = (appMetrics: Electron.ProcessMetric[], detailed: boolean) => {
       expect(appMetrics).to.be.an('array').and.have.lengthOf.at.least(1, 'App memory info object is not > 0');
 
       const types = [];
@@ -1373,10 +1382,19 @@ describe('app module', () => {
           expect(entry).to.have.property('name').that.is.a('string');
         }
 
-        if (process.platform === 'win32') {
+        if (process.platform === 'win32' || (process.platform === 'linux' && detailed)) {
           expect(entry.memory).to.have.property('privateBytes').that.is.greaterThan(0);
         }
 
+        if (process.platform === 'linux') {
+          if (detailed) {
+            expect(entry.memory).to.have.property('sharedBytes').that.is.a('number');
+            expect(entry.memory).to.have.property('swapBytes').that.is.a('number');
+          } else {
+            expect(entry.memory).to.not.have.property('privateBytes');
+          }
+        }
+
         if (process.platform !== 'linux') {
           expect(entry.sandboxed).to.be.a('boolean');
         }
@@ -1391,6 +1409,14 @@ describe('app module', () => {
       }
 
       expect(types).to.include('Browser');
+    };
+
+    it('returns memory and cpu stats of all running electron processes', () => {
+      checkAppMetrics(app.getAppMetrics(), false);
+    });
+
+    it('can sample the stats of all processes asynchronously', async () => {
+      checkAppMetrics(await app.sampleAppMetrics(), true);
     });
   });
 
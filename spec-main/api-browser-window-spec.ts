@@ -2389,6 +2389,29 @@ describe('BrowserWindow module', () => {
         expect(test).to.equal('preload');
       });
 
+      it('consumes the code cache of a preload script that runs again', async () => {
+        const w = new BrowserWindow({
+          show: false,
+          webPreferences: {
+            sandbox: true,
+            preload,
+            contextIsolation: false
+          }
+        });
+        await w.loadFile(path.join(fixtures, 'api', 'preload.html'));
+        const pid = w.webContents.getOSProcessId();
+        const first = await w.webContents.executeJavaScript('process.getPreloadCodeCacheStats()');
+        expect(first.misses).to.be.at.least(1);
+        expect(first.count).to.be.at.least(1);
+
+        w.webContents.reload();
+        await emittedOnce(w.webContents, 'did-finish-load');
+        expect(w.webContents.getOSProcessId()).to.equal(pid);
+        const second = await w.webContents.executeJavaScript('process.getPreloadCodeCacheStats()');
+        expect(second.hits).to.equal(first.hits + 1);
+        expect(second.misses).to.equal(first.misses);
+      });
+
       it('exposes ipcRenderer to preload script (path has special chars)', async () => {
         const preloadSpecialChars = path.join(fixtures, 'module', 'preload-sandboxæø åü.js');
         const w = new BrowserWindow({
@@ -2404,6 +2427,31 @@ describe('BrowserWindow module', () => {
         expect(test).to.equal('preload');
       });
 
+      it('picks up changes to the preload script on reload', async () => {
+        const tmpDir = await fs.promises.mkdtemp(path.join(os.tmpdir(), 'electron-preload-'));
+        const tmpPreload = path.join(tmpDir, 'preload.js');
+        const writePreload = async (answer: string, mtime: Date) => {
+          await fs.promises.writeFile(tmpPreload, `require('electron').ipcRenderer.send('answer', '${answer}')`);
+          await fs.promises.utimes(tmpPreload, mtime, mtime);
+        };
+        await writePreload('first', new Date(2000, 1, 1));
+        const w = new BrowserWindow({
+          show: false,
+          webPreferences: {
+            sandbox: true,
+            preload: tmpPreload
+          }
+        });
+        w.loadURL('about:blank');
+        const [, first] = await emittedOnce(ipcMain, 'answer');
+        expect(first).to.equal('first');
+        await writePreload('second', new Date(2001, 1, 1));
+        w.webContents.reload();
+        const [, second] = await emittedOnce(ipcMain, 'answer');
+        expect(second).to.equal('second');
+        await fs.promises.rm(tmpDir, { recursive: true, force: true });
+      });
+
       it('exposes "loaded" event to preload script', async () => {
         const w = new BrowserWindow({
           show: false,
@@ -1,5 +1,5 @@
 import { expect } from 'chai';
-import { app, contentTracing, TraceConfig, TraceCategoriesAndOptions } from 'electron/main';
+import { app, BrowserWindow, contentTracing, TraceConfig, TraceCategoriesAndOptions } from 'electron/main';
 import * as fs from 'fs';
 import * as path from 'path';
 import { ifdescribe, delay } from './spec-helpers';
@@ -117,6 +117,65 @@ ifdescribe(!(['arm', 'arm64', 'ia32'].includes(process.arch)))('contentTracing',
     });
   });
 
+  describe('flight recording', function () {
+    this.timeout(5e3);
+
+    afterEach(async () => {
+      await contentTracing.stopRecording().catch(() => {});
+    });
+
+    it('keeps recording after a dump', async () => {
+      await app.whenReady();
+      await contentTracing.startFlightRecording();
+
+      const firstPath = await contentTracing.dumpFlightRecording(outputFilePath);
+      expect(firstPath).to.equal(outputFilePath);
+      expect(fs.statSync(outputFilePath).size).to.be.above(0);
+
+      const secondPath = await contentTracing.dumpFlightRecording();
+      expect(fs.existsSync(secondPath)).to.be.true('output exists');
+    });
+
+    it('rejects a dump while another one is in progress', async () => {
+      await app.whenReady();
+      await contentTracing.startFlightRecording();
+
+      const firstDump = contentTracing.dumpFlightRecording(outputFilePath);
+      await expect(contentTracing.dumpFlightRecording()).to.be.rejectedWith(/already in progress/);
+      expect(await firstDump).to.equal(outputFilePath);
+    });
+
+    it('rejects dumps when no flight recording is in progress', async () => {
+      await app.whenReady();
+      await expect(contentTracing.dumpFlightRecording()).to.be.rejectedWith(/No flight recording in progress/);
+    });
+
+    it('detaches its unresponsive handlers when recording stops', async () => {
+      await app.whenReady();
+      const w = new BrowserWindow({ show: false });
+      try {
+        const createdListeners = app.listenerCount('web-contents-created');
+        const unresponsiveListeners = w.webContents.listenerCount('unresponsive');
+
+        await contentTracing.startFlightRecording({ unresponsiveDumpPath: outputFilePath });
+        expect(app.listenerCount('web-contents-created')).to.equal(createdListeners + 1);
+        expect(w.webContents.listenerCount('unresponsive')).to.equal(unresponsiveListeners + 1);
+
+        await contentTracing.stopRecording();
+        expect(app.listenerCount('web-contents-created')).to.equal(createdListeners);
+        expect(w.webContents.listenerCount('unresponsive')).to.equal(unresponsiveListeners);
+      } finally {
+        w.destroy();
+      }
+    });
+
+    it('rejects when a trace is already in progress', async () => {
+      await app.whenReady();
+      await contentTracing.startRecording({});
+      await expect(contentTracing.startFlightRecording()).to.be.rejectedWith(/already in progress/);
+    });
+  });
+
   describe('captured events', () => {
     it('include V8 samples from the main process', async function () {
       // This test is flaky on macOS CI.
@@ -90,6 +90,27 @@ describe('debugger module', () => {
       w.webContents.debugger.detach();
     });
 
+    it('returns large and nested responses intact', async () => {
+      w.webContents.loadURL('about:blank');
+      w.webContents.debugger.attach();
+
+      const value = {
+        text: 'h\u00e9llo \u2713 \ud83d\ude00',
+        nested: { list: [1, 'two', null, true, { deep: [3.5, -0] }] },
+        big: 'x'.repeat(4 * 1024 * 1024)
+      };
+      const res = await w.webContents.debugger.sendCommand('Runtime.evaluate', {
+        expression: `(${JSON.stringify(value)})`,
+        returnByValue: true
+      });
+      expect(res.result.value).to.deep.equal(JSON.parse(JSON.stringify(value)));
+
+      // Commands without a result resolve with an empty object.
+      expect(await w.webContents.debugger.sendCommand('Page.enable')).to.deep.equal({});
+
+      w.webContents.debugger.detach();
+    });
+
     it('returns response when devtools is opened', async () => {
       w.webContents.loadURL('about:blank');
       w.webContents.debugger.attach();
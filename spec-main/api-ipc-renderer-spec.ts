@@ -128,6 +128,88 @@ describe('ipcRenderer module', () => {
     });
   });
 
+  describe('process.getIPCChannelMetrics()', () => {
+    // The main process table lives for the whole spec run, so per-channel
+    // counts are checked in the renderer of a fresh window.
+    let metricsWindow: BrowserWindow;
+    beforeEach(async () => {
+      metricsWindow = new BrowserWindow({ show: false, webPreferences: { nodeIntegration: true, contextIsolation: false } });
+      await metricsWindow.loadURL('about:blank');
+    });
+    afterEach(async () => {
+      await closeWindow(metricsWindow);
+      metricsWindow = null as unknown as BrowserWindow;
+    });
+
+    const getMetrics = (metrics: Electron.IPCChannelMetrics[], channel: string) =>
+      metrics.find(entry => entry.channel === channel);
+    const getTotalReceived = () =>
+      process.getIPCChannelMetrics().reduce((total, entry) => total + entry.received, 0);
+
+    it('counts messages on both ends of a channel', async () => {
+      const receivedBefore = getTotalReceived();
+      metricsWindow.webContents.executeJavaScript(`{
+        const { ipcRenderer } = require('electron')
+        ipcRenderer.send('metrics-channel', 'a')
+        ipcRenderer.send('metrics-channel', 'b')
+      }`);
+      await emittedOnce(ipcMain, 'metrics-channel');
+      await emittedOnce(ipcMain, 'metrics-channel');
+      expect(getTotalReceived() - receivedBefore).to.be.at.least(2);
+
+      const replies = metricsWindow.webContents.executeJavaScript(`new Promise(resolve => {
+        const { ipcRenderer } = require('electron')
+        let count = 0
+        ipcRenderer.on('metrics-reply', () => { if (++count === 2) resolve() })
+      })`);
+      metricsWindow.webContents.send('metrics-reply', 'a');
+      metricsWindow.webContents.send('metrics-reply', 'b');
+      await replies;
+
+      const metrics = await metricsWindow.webContents.executeJavaScript('process.getIPCChannelMetrics()');
+      const sent = getMetrics(metrics, 'metrics-channel');
+      expect(sent).to.have.property('sent', 2);
+      expect(sent).to.have.property('bytesSent').that.is.greaterThan(0);
+      expect(sent).to.have.property('serializationTime').that.is.at.least(0);
+      const received = getMetrics(metrics, 'metrics-reply');
+      expect(received).to.have.property('received', 2);
+      expect(received).to.have.property('bytesReceived').that.is.greaterThan(0);
+      expect(received).to.have.property('handlerTime').that.is.at.least(0);
+    });
+
+    it('folds the quietest channels past the limit into a single entry', async () => {
+      const done = emittedOnce(ipcMain, 'metrics-many-done');
+      metricsWindow.webContents.executeJavaScript(`{
+        const { ipcRenderer } = require('electron')
+        for (let i = 0; i < 50; i++) ipcRenderer.send('metrics-noisy')
+        for (let i = 0; i < 600; i++) ipcRenderer.send('metrics-many-' + i)
+        ipcRenderer.send('metrics-many-done')
+      }`);
+      await done;
+
+      const received = process.getIPCChannelMetrics();
+      expect(received.length).to.be.at.most(257);
+      expect(received.find(entry => entry.other)).to.have.property('received').that.is.greaterThan(0);
+
+      const metrics: Electron.IPCChannelMetrics[] = await metricsWindow.webContents.executeJavaScript('process.getIPCChannelMetrics()');
+      expect(metrics.length).to.be.at.most(257);
+      expect(metrics.find(entry => entry.other)).to.have.property('sent').that.is.greaterThan(0);
+      expect(getMetrics(metrics, 'metrics-noisy')).to.have.property('sent', 50);
+    });
+
+    it('still delivers messages past the channel ID limit', async () => {
+      const received = emittedOnce(ipcMain, 'metrics-late');
+      metricsWindow.webContents.executeJavaScript(`{
+        const { ipcRenderer } = require('electron')
+        for (let i = 0; i < 600; i++) ipcRenderer.send('metrics-limit-' + i)
+        ipcRenderer.invoke('metrics-late-invoke').then(result => ipcRenderer.send('metrics-late', result))
+      }`);
+      ipcMain.handleOnce('metrics-late-invoke', () => 'handled');
+      const [, result] = await received;
+      expect(result).to.equal('handled');
+    });
+  });
+
   describe('sendTo()', () => {
     const generateSpecs = (description: string, webPreferences: WebPreferences) => {
       describe(description, () => {
@@ -172,6 +254,8 @@ describe('ipcRenderer module', () => {
     generateSpecs('with sandbox', { sandbox: true });
     generateSpecs('with contextIsolation', { contextIsolation: true });
     generateSpecs('with contextIsolation + sandbox', { contextIsolation: true, sandbox: true });
+    generateSpecs('with directSendTo', { directSendTo: true });
+    generateSpecs('with directSendTo + sandbox', { directSendTo: true, sandbox: true });
   });
 
   describe('ipcRenderer.on', () => {
@@ -1,6 +1,9 @@
 import { expect } from 'chai';
 import { net, session, ClientRequest, BrowserWindow, ClientRequestConstructorOptions } from 'electron/main';
+import * as fs from 'fs';
 import * as http from 'http';
+import * as os from 'os';
+import * as path from 'path';
 import * as url from 'url';
 import { AddressInfo, Socket } from 'net';
 import { emittedOnce } from './events-helpers';
@@ -147,6 +150,51 @@ describe('net module', () => {
       await collectStreamBody(response);
     });
 
+    it('should pass the request priority to the network stack', async () => {
+      const serverUrl = await respondOnce.toSingleURL((request, response) => {
+        response.end();
+      });
+      const ses = session.fromPartition(`net-priority-${Math.random()}`);
+      const logPath = path.join(os.tmpdir(), `net-priority-${process.pid}.json`);
+      defer(() => fs.promises.unlink(logPath).catch(() => {}));
+
+      await ses.netLog.startLogging(logPath);
+      const urlRequest = net.request({
+        url: serverUrl,
+        session: ses,
+        priority: 'highest'
+      });
+      const response = await getResponse(urlRequest);
+      expect(response.statusCode).to.equal(200);
+      await collectStreamBody(response);
+      await ses.netLog.stopLogging();
+
+      // URL_REQUEST_START_JOB events carry the priority of the request.
+      const { events } = JSON.parse(await fs.promises.readFile(logPath, 'utf8'));
+      const priorities = events
+        .filter((event: any) => event.params && event.params.url === serverUrl && event.params.priority)
+        .map((event: any) => event.params.priority);
+      expect(priorities).to.include('HIGHEST');
+    });
+
+    it('should throw on an invalid request priority', () => {
+      expect(() => net.request({
+        url: 'http://127.0.0.1',
+        priority: 'urgent' as any
+      })).to.throw(/priority should be one of/);
+    });
+
+    it('should report the connection used for the response', async () => {
+      const serverUrl = await respondOnce.toSingleURL((request, response) => {
+        response.end();
+      });
+      const urlRequest = net.request(serverUrl);
+      const response = await getResponse(urlRequest);
+      expect(response.connectionInfo).to.equal('http/1.1');
+      expect(response.socketReused).to.be.a('boolean');
+      await collectStreamBody(response);
+    });
+
     it('should fetch correct data in a GET request', async () => {
       const expectedBodyData = 'Hello World!';
       const serverUrl = await respondOnce.toSingleURL((request, response) => {
@@ -176,6 +224,53 @@ describe('net module', () => {
       expect(response.statusCode).to.equal(200);
     });
 
+    it('should stop reading the response while it is paused', async () => {
+      const chunk = randomBuffer(64 * kOneKiloByte);
+      const chunkCount = 512;
+      let written = 0;
+      const serverUrl = await respondOnce.toSingleURL(async (request, response) => {
+        response.statusCode = 200;
+        for (let i = 0; i < chunkCount; i++) {
+          written += chunk.length;
+          if (!response.write(chunk)) await emittedOnce(response, 'drain');
+        }
+        response.end();
+      });
+      const response = await getResponse(net.request(serverUrl));
+      await emittedOnce(response, 'data');
+      response.pause();
+      await delay(500);
+      // Loopback socket and data pipe buffers are far smaller than the body.
+      expect(written).to.be.lessThan(chunk.length * chunkCount);
+
+      const rest = await collectStreamBodyBuffer(response.resume());
+      expect(rest.length).to.be.greaterThan(0);
+      expect(written).to.equal(chunk.length * chunkCount);
+    });
+
+    it('should emit all data before the end of a response read slowly', async () => {
+      const body = randomBuffer(4 * kOneMegaByte);
+      const serverUrl = await respondOnce.toSingleURL((request, response) => {
+        response.statusCode = 200;
+        for (let i = 0; i < body.length; i += 16 * kOneKiloByte) {
+          response.write(body.slice(i, i + 16 * kOneKiloByte));
+        }
+        response.end();
+      });
+      const response = await getResponse(net.request(serverUrl));
+      const received = await new Promise<Buffer>((resolve, reject) => {
+        const chunks: Buffer[] = [];
+        response.on('error', reject);
+        response.on('data', (data: Buffer) => {
+          chunks.push(data);
+          response.pause();
+          setTimeout(() => response.resume(), 1);
+        });
+        response.on('end', () => resolve(Buffer.concat(chunks)));
+      });
+      expect(received.equals(body)).to.be.true();
+    });
+
     it('should support chunked encoding', async () => {
       const serverUrl = await respondOnce.toSingleURL((request, response) => {
         response.statusCode = 200;
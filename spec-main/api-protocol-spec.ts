@@ -176,6 +176,21 @@ describe('protocol module', () => {
       registerStringProtocol(protocolName, (request, callback) => callback(notAString as any));
       await expect(ajax(protocolName + '://fake-host')).to.be.eventually.rejected();
     });
+
+    it('throws when the callback is called more than once', async () => {
+      let error: Error | undefined;
+      registerStringProtocol(protocolName, (request, callback) => {
+        callback(text);
+        try {
+          callback(text);
+        } catch (e) {
+          error = e;
+        }
+      });
+      const r = await ajax(protocolName + '://fake-host');
+      expect(r.data).to.equal(text);
+      expect(error).to.be.an.instanceOf(TypeError).with.property('message', 'One-time callback was called more than once');
+    });
   });
 
   describe('protocol.registerBufferProtocol', () => {
@@ -322,6 +337,46 @@ describe('protocol module', () => {
       expect(r.data).to.equal(text);
     });
 
+    it('forwards the request body when streamUploadData is set', async () => {
+      const server = http.createServer((req, res) => {
+        let body = '';
+        req.on('data', (chunk) => {
+          body += chunk;
+        });
+        req.on('end', () => {
+          res.end(body);
+        });
+      });
+      after(() => server.close());
+      await new Promise<void>(resolve => server.listen(0, '127.0.0.1', resolve));
+
+      const port = (server.address() as AddressInfo).port;
+      const url = `http://127.0.0.1:${port}`;
+      registerHttpProtocol(protocolName, (request, callback) => callback({ url, streamUploadData: true }));
+      const r = await ajax(protocolName + '://fake-host', { method: 'POST', body: qs.stringify(postData) });
+      expect({ ...qs.parse(r.data) }).to.deep.equal(postData);
+    });
+
+    it('does not forward the request body by default', async () => {
+      const server = http.createServer((req, res) => {
+        let body = '';
+        req.on('data', (chunk) => {
+          body += chunk;
+        });
+        req.on('end', () => {
+          res.end(body);
+        });
+      });
+      after(() => server.close());
+      await new Promise<void>(resolve => server.listen(0, '127.0.0.1', resolve));
+
+      const port = (server.address() as AddressInfo).port;
+      const url = `http://127.0.0.1:${port}`;
+      registerHttpProtocol(protocolName, (request, callback) => callback({ url }));
+      const r = await ajax(protocolName + '://fake-host', { method: 'POST', body: qs.stringify(postData) });
+      expect(r.data).to.equal('');
+    });
+
     it('can access request headers', (done) => {
       protocol.registerHttpProtocol(protocolName, (request) => {
         try {
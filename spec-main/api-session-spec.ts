@@ -122,6 +122,21 @@ describe('session module', () => {
       expect(cs.some(c => c.name === name && c.value === value)).to.equal(true);
     });
 
+    it('filters cookies by parent domain', async () => {
+      const { cookies } = session.defaultSession;
+      const name = 'domain-filter';
+      const value = '1';
+
+      await cookies.set({ url: 'http://sub.example.com', domain: 'sub.example.com', name, value });
+      await cookies.set({ url: 'http://notexample.com', name, value });
+      for (const domain of ['example.com', '.example.com', 'sub.example.com']) {
+        const cs = await cookies.get({ domain, name });
+        expect(cs.map(c => c.domain)).to.deep.equal(['.sub.example.com']);
+      }
+      await cookies.remove('http://sub.example.com', name);
+      await cookies.remove('http://notexample.com', name);
+    });
+
     it('yields an error when setting a cookie with missing required fields', async () => {
       const { cookies } = session.defaultSession;
       const name = '1';
@@ -528,6 +543,55 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.readBlobData()', () => {
+    const scheme = 'cors-blob';
+    const protocol = session.defaultSession.protocol;
+    const url = `${scheme}://host`;
+    after(async () => {
+      await protocol.unregisterProtocol(scheme);
+    });
+    afterEach(closeAllWindows);
+
+    it('reads a blob larger than the data pipe in chunks', (done) => {
+      // Larger than the default data pipe capacity, so it can not be read in
+      // one go.
+      const size = 4 * 1024 * 1024;
+      const content = `<html>
+                       <script>
+                       let fd = new FormData();
+                       fd.append('file', new Blob([new Uint8Array(${size}).fill(97)]));
+                       fetch('${url}', {method:'POST', body: fd });
+                       </script>
+                       </html>`;
+
+      protocol.registerStringProtocol(scheme, async (request, callback) => {
+        try {
+          if (request.method === 'GET') {
+            callback({ data: content, mimeType: 'text/html' });
+          } else if (request.method === 'POST') {
+            const uuid = request.uploadData![1].blobUUID;
+            expect(uuid).to.be.a('string');
+            const chunks: Buffer[] = [];
+            for (;;) {
+              const chunk = await session.defaultSession.readBlobData(uuid!);
+              if (!chunk) break;
+              chunks.push(chunk);
+            }
+            expect(chunks).to.have.lengthOf.above(1);
+            const data = Buffer.concat(chunks);
+            expect(data).to.have.lengthOf(size);
+            expect(data.every(byte => byte === 97)).to.be.true();
+            done();
+          }
+        } catch (e) {
+          done(e);
+        }
+      });
+      const w = new BrowserWindow({ show: false });
+      w.loadURL(url);
+    });
+  });
+
   describe('ses.setCertificateVerifyProc(callback)', () => {
     let server: http.Server;
 
@@ -1066,6 +1130,53 @@ describe('session module', () => {
     });
   });
 
+  describe('ses.setSpareRendererPreferences(webPreferences)', () => {
+    afterEach(closeAllWindows);
+
+    const setSpareRendererPreferences = async (ses: Session, webPreferences: Electron.WebPreferences) => {
+      const ready = emittedOnce(ses, 'spare-renderer-ready');
+      ses.setSpareRendererPreferences(webPreferences);
+      const [, pid] = await ready;
+      return pid as number;
+    };
+
+    it('throws when not passed an object or null', () => {
+      expect(() => {
+        (session.defaultSession as any).setSpareRendererPreferences('sandbox');
+      }).to.throw('Must pass null or object');
+    });
+
+    it('hands the spare renderer to a window with matching preferences', async () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      defer(() => ses.setSpareRendererPreferences(null));
+      const pid = await setSpareRendererPreferences(ses, { sandbox: true });
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: true } });
+      await w.loadURL('about:blank');
+      expect(w.webContents.getOSProcessId()).to.equal(pid);
+    });
+
+    it('does not hand the spare renderer to a window with other preferences', async () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      defer(() => ses.setSpareRendererPreferences(null));
+      const pid = await setSpareRendererPreferences(ses, { sandbox: true });
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: false, nodeIntegration: true } });
+      await w.loadURL('about:blank');
+      expect(w.webContents.getOSProcessId()).to.not.equal(pid);
+    });
+
+    it('stops handing out the spare renderer when passed null', async () => {
+      const ses = session.fromPartition(`${Math.random()}`);
+      const pid = await setSpareRendererPreferences(ses, { sandbox: true });
+      ses.setSpareRendererPreferences(null);
+
+      const w = new BrowserWindow({ show: false, webPreferences: { session: ses, sandbox: true } });
+      await w.loadURL('about:blank');
+      expect(w.webContents.getOSProcessId()).to.not.equal(pid);
+    });
+  });
+
   describe('ses.setUserAgent()', () => {
     afterEach(closeAllWindows);
 
@@ -7,7 +7,7 @@ import { BrowserWindow, ipcMain, webContents, session, WebContents, app, Browser
 import { clipboard } from 'electron/common';
 import { emittedOnce } from './events-helpers';
 import { closeAllWindows } from './window-helpers';
-import { ifdescribe, ifit, delay, defer } from './spec-helpers';
+import { ifdescribe, ifit, delay, defer, waitUntil } from './spec-helpers';
 
 const pdfjs = require('pdfjs-dist');
 const fixturesPath = path.resolve(__dirname, '..', 'spec', 'fixtures');
@@ -1504,6 +1504,19 @@ describe('webContents module', () => {
       });
       w.loadFile(path.join(fixturesPath, 'pages', 'a.html'));
     });
+
+    it('is passed to an overridden emit when there are no listeners', async () => {
+      const w = new BrowserWindow({ show: false });
+      const messages: string[] = [];
+      const emit = w.webContents.emit;
+      w.webContents.emit = function (name: string, ...args: any[]) {
+        if (name === 'console-message') messages.push(args[2]);
+        return emit.call(this, name, ...args);
+      };
+      await w.loadURL('about:blank');
+      await w.webContents.executeJavaScript('console.log("a")');
+      await waitUntil(() => messages.includes('a'));
+    });
   });
 
   describe('ipc-message event', () => {
@@ -1818,7 +1831,8 @@ describe('webContents module', () => {
         headerFooter: '123',
         printSelectionOnly: 1,
         printBackground: 2,
-        pageSize: 'IAmAPageSize'
+        pageSize: 'IAmAPageSize',
+        path: 42
       };
 
       // These will hard crash in Chromium unless we type-check
@@ -1857,6 +1871,29 @@ describe('webContents module', () => {
       }
     });
 
+    it('can write the PDF to a file', async () => {
+      const pdfPath = path.join(app.getPath('temp'), `print-to-pdf-${process.pid}.pdf`);
+      defer(() => fs.promises.unlink(pdfPath).catch(() => {}));
+
+      const data = await w.webContents.printToPDF({ path: pdfPath });
+      expect(data).to.be.an.instanceof(Buffer).that.is.empty();
+      const contents = await fs.promises.readFile(pdfPath);
+      expect(contents.slice(0, 4).toString()).to.equal('%PDF');
+    });
+
+    it('rejects when the PDF cannot be written', async () => {
+      const pdfPath = path.join(app.getPath('temp'), 'does-not-exist', 'nested', 'out.pdf');
+      await expect(w.webContents.printToPDF({ path: pdfPath })).to.eventually.be.rejectedWith('Failed to write PDF to file');
+    });
+
+    it('handles queued requests after one is rejected', async () => {
+      const pdfPath = path.join(app.getPath('temp'), 'does-not-exist', 'nested', 'out.pdf');
+      const failed = w.webContents.printToPDF({ path: pdfPath });
+      const queued = w.webContents.printToPDF({});
+      await expect(failed).to.eventually.be.rejectedWith('Failed to write PDF to file');
+      expect(await queued).to.be.an.instanceof(Buffer).that.is.not.empty();
+    });
+
     // TODO(codebytere): Re-enable after Chromium fixes upstream v8_scriptormodule_legacy_lifetime crash.
     xdescribe('using a large document', () => {
       beforeEach(async () => {
@@ -52,13 +52,16 @@ describe('webFrame module', () => {
     w.focus();
     await w.webContents.executeJavaScript('document.querySelector("input").focus()', true);
 
+    const expectedWords = ['spleling', 'test', 'you\'re', 'you', 're'];
+    const checkedWords: string[] = [];
     const spellCheckerFeedback =
-      new Promise<[string[], boolean]>(resolve => {
+      new Promise<boolean>(resolve => {
         ipcMain.on('spec-spell-check', (e, words, callbackDefined) => {
-          if (words.length === 5) {
-            // The API calls the provider after every completed word.
-            // The promise is resolved only after this event is received with all words.
-            resolve([words, callbackDefined]);
+          // The API calls the provider after every completed word, with only
+          // the words it has not checked before.
+          checkedWords.push(...words);
+          if (expectedWords.every(word => checkedWords.includes(word))) {
+            resolve(callbackDefined);
           }
         });
       });
@@ -66,8 +69,82 @@ describe('webFrame module', () => {
     for (const keyCode of inputText) {
       w.webContents.sendInputEvent({ type: 'char', keyCode });
     }
-    const [words, callbackDefined] = await spellCheckerFeedback;
-    expect(words.sort()).to.deep.equal(['spleling', 'test', 'you\'re', 'you', 're'].sort());
+    const callbackDefined = await spellCheckerFeedback;
+    expect(checkedWords).to.include.members(expectedWords);
+    expect(checkedWords).to.have.lengthOf(new Set(checkedWords).size);
     expect(callbackDefined).to.be.true();
   });
+
+  describe('with a spellcheck provider', () => {
+    let w: BrowserWindow;
+    let checkedWords: string[];
+
+    const loadSpellCheckPage = async (delay: number, failOnce?: 'throw' | 'ignore') => {
+      w = new BrowserWindow({
+        show: false,
+        webPreferences: {
+          nodeIntegration: true,
+          contextIsolation: false
+        }
+      });
+      await w.loadFile(path.join(fixtures, 'pages', 'webframe-spell-check.html'), { query: { delay: String(delay), failOnce: failOnce || '' } });
+      w.focus();
+      await w.webContents.executeJavaScript('document.querySelector("input").focus()', true);
+    };
+
+    const typeAndWaitFor = (text: string, expectedWords: string[]) => {
+      const checked = new Promise<void>(resolve => {
+        const listener = (e: Electron.IpcMainEvent, words: string[]) => {
+          checkedWords.push(...words);
+          if (expectedWords.every(word => checkedWords.includes(word))) {
+            ipcMain.removeListener('spec-spell-check', listener);
+            resolve();
+          }
+        };
+        ipcMain.on('spec-spell-check', listener);
+      });
+      for (const keyCode of text) {
+        w.webContents.sendInputEvent({ type: 'char', keyCode });
+      }
+      return checked;
+    };
+
+    beforeEach(() => {
+      checkedWords = [];
+    });
+
+    it('does not send words again while an asynchronous provider checks them', async () => {
+      await loadSpellCheckPage(500);
+      await typeAndWaitFor('spleling a b c ', ['spleling', 'a', 'b', 'c']);
+      expect(checkedWords).to.have.lengthOf(new Set(checkedWords).size);
+    });
+
+    it('sends words again after the cache is cleared', async () => {
+      await loadSpellCheckPage(0);
+      await typeAndWaitFor('spleling ', ['spleling']);
+      await w.webContents.executeJavaScript('require("electron").webFrame.clearSpellCheckCache()');
+      checkedWords = [];
+      await typeAndWaitFor('spleling ', ['spleling']);
+      expect(checkedWords).to.include('spleling');
+    });
+
+    it('sends words again after the provider throws', async () => {
+      await loadSpellCheckPage(0, 'throw');
+      await typeAndWaitFor('spleling ', ['spleling']);
+      checkedWords = [];
+      await typeAndWaitFor('spleling ', ['spleling']);
+      expect(checkedWords).to.include('spleling');
+    });
+
+    it('sends words again when the provider does not answer', async () => {
+      await loadSpellCheckPage(0, 'ignore');
+      await typeAndWaitFor('spleling ', ['spleling']);
+      checkedWords = [];
+      // Resent by the pending request without any further typing.
+      const resent = new Promise<string[]>(resolve => {
+        ipcMain.once('spec-spell-check', (e, words: string[]) => resolve(words));
+      });
+      expect(await resent).to.include('spleling');
+    });
+  });
 });
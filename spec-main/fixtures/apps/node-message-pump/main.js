@@ -0,0 +1,38 @@
+const { app } = require('electron');
+const fs = require('fs');
+
+const results = {};
+
+process.on('exit', () => {
+  process.stdout.write(JSON.stringify(results));
+});
+
+const waitForTimeout = (ms) => new Promise(resolve => setTimeout(resolve, ms));
+
+const waitForInterval = (count) => new Promise(resolve => {
+  let ticks = 0;
+  const interval = setInterval(() => {
+    if (++ticks === count) {
+      clearInterval(interval);
+      resolve(ticks);
+    }
+  }, 10);
+});
+
+const readFile = (file) => new Promise((resolve, reject) => {
+  fs.readFile(file, 'utf8', (error, data) => error ? reject(error) : resolve(data));
+});
+
+app.whenReady().then(async () => {
+  const start = Date.now();
+  await waitForTimeout(50);
+  results.timeout = Date.now() - start >= 45;
+  results.interval = await waitForInterval(3);
+  results.immediate = await new Promise(resolve => setImmediate(() => resolve(true)));
+  results.readFile = (await readFile(__filename)) === fs.readFileSync(__filename, 'utf8');
+  results.stat = (await fs.promises.stat(__filename)).isFile();
+
+  // A pending timer must not keep process.exit() from exiting.
+  setTimeout(() => {}, 60 * 1000);
+  process.exit(42);
+});
@@ -0,0 +1,39 @@
+const { app } = require('electron');
+const { Worker } = require('worker_threads');
+
+// (a, b) => a + b
+const addModule = new Uint8Array([
+  0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x07, 0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,
+  0x03, 0x02, 0x01, 0x00,
+  0x07, 0x07, 0x01, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00,
+  0x0a, 0x09, 0x01, 0x07, 0x00, 0x20, 0x00, 0x20, 0x01, 0x6a, 0x0b
+]);
+
+const runWorker = () => new Promise((resolve, reject) => {
+  const worker = new Worker('require("worker_threads").parentPort.postMessage(6 * 7)', { eval: true });
+  let result = null;
+  worker.on('message', (message) => { result = message; });
+  worker.on('error', reject);
+  worker.on('exit', () => resolve(result));
+});
+
+app.whenReady().then(async () => {
+  // The worker's isolate is drained on every turn of its loop and when it
+  // exits; neither may affect the worker tasks of the main isolate.
+  const worker = await runWorker();
+
+  // Asynchronous WebAssembly compilation and the GC both depend on V8 worker
+  // tasks running.
+  const { instance } = await WebAssembly.instantiate(addModule);
+  let garbage = [];
+  for (let i = 0; i < 200; i++) {
+    garbage.push(new Array(10000).fill(i));
+    if (garbage.length > 20) garbage = [];
+  }
+  const wasm = instance.exports.add(40, 2);
+
+  process.stdout.write(JSON.stringify({ worker, wasm }));
+  process.stdout.end();
+  app.quit();
+});
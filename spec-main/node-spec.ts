@@ -34,6 +34,36 @@ describe('node feature', () => {
     expect(code).to.equal(0);
   });
 
+  ifdescribe(process.platform === 'linux')('with the NodeMessagePumpIntegration feature', () => {
+    it('runs timers and fs callbacks, and exits', async () => {
+      const appPath = path.join(mainFixturesPath, 'apps', 'node-message-pump');
+      const appProcess = childProcess.spawn(process.execPath, [appPath, '--enable-features=NodeMessagePumpIntegration']);
+      let output = '';
+      appProcess.stdout.on('data', (data) => { output += data; });
+      const [code] = await emittedOnce(appProcess, 'close');
+      expect(code).to.equal(42);
+      expect(JSON.parse(output)).to.deep.equal({
+        timeout: true,
+        interval: 3,
+        immediate: true,
+        readFile: true,
+        stat: true
+      });
+    });
+  });
+
+  describe('with the V8WorkerTasksOnThreadPool feature', () => {
+    it('keeps running V8 worker tasks after a worker_threads Worker has run', async () => {
+      const appPath = path.join(mainFixturesPath, 'apps', 'v8-worker-tasks');
+      const appProcess = childProcess.spawn(process.execPath, [appPath, '--enable-features=V8WorkerTasksOnThreadPool']);
+      let output = '';
+      appProcess.stdout.on('data', (data) => { output += data; });
+      const [code] = await emittedOnce(appProcess, 'close');
+      expect(code).to.equal(0);
+      expect(JSON.parse(output)).to.deep.equal({ worker: 42, wasm: 42 });
+    });
+  });
+
   describe('contexts', () => {
     describe('setTimeout called under Chromium event loop in browser process', () => {
       it('Can be scheduled in time', (done) => {
@@ -200,6 +230,19 @@ describe('node feature', () => {
     });
   });
 
+  describe('process.getArrayBufferAllocatorInfo()', () => {
+    it('accounts for Buffer allocations', () => {
+      const before = process.getArrayBufferAllocatorInfo();
+      const buffers = Array.from({ length: 16 }, () => Buffer.alloc(64 * 1024));
+      const after = process.getArrayBufferAllocatorInfo();
+      // The counters only grow, so a GC between the samples cannot lower them.
+      expect(after.allocationCount - before.allocationCount).to.be.at.least(buffers.length);
+      expect(after.totalAllocated - before.totalAllocated).to.be.at.least(buffers.length * 64 - 1);
+      expect(after.committed).to.be.at.least(after.allocated);
+      expect(buffers.every(buffer => buffer.length === 64 * 1024)).to.be.true();
+    });
+  });
+
   describe('fs.readFile', () => {
     it('can accept a FileHandle as the Path argument', async () => {
       const filePathForHandle = path.resolve(mainFixturesPath, 'dogs-running.txt');
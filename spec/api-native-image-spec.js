@@ -3,6 +3,8 @@
 const { expect } = require('chai');
 const { nativeImage } = require('electron');
 const { ifdescribe, ifit } = require('./spec-helpers');
+const fs = require('fs');
+const os = require('os');
 const path = require('path');
 
 describe('nativeImage module', () => {
@@ -369,6 +371,60 @@ describe('nativeImage module', () => {
       expect(image.getSize()).to.deep.equal({ width: 538, height: 190 });
     });
 
+    describe('cache', () => {
+      afterEach(() => {
+        nativeImage.setCacheLimit(16 * 1024 * 1024);
+      });
+
+      it('decodes the same path once', () => {
+        const imagePath = path.join(__dirname, 'fixtures', 'assets', 'logo.png');
+        nativeImage.createFromPath(imagePath);
+        const { hits, misses } = nativeImage.getCacheStats();
+        const image = nativeImage.createFromPath(imagePath);
+        expect(image.getSize()).to.deep.equal({ width: 538, height: 190 });
+        expect(nativeImage.getCacheStats()).to.include({ hits: hits + 1, misses });
+      });
+
+      it('decodes the file again after it changes', () => {
+        const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'electron-native-image-spec-'));
+        const imagePath = path.join(dir, 'image.png');
+        try {
+          fs.copyFileSync(path.join(__dirname, 'fixtures', 'assets', 'logo.png'), imagePath);
+          expect(nativeImage.createFromPath(imagePath).getSize()).to.deep.equal({ width: 538, height: 190 });
+
+          fs.copyFileSync(path.join(__dirname, 'fixtures', 'assets', '1x1.png'), imagePath);
+          expect(nativeImage.createFromPath(imagePath).getSize()).to.deep.equal({ width: 1, height: 1 });
+        } finally {
+          fs.rmSync(dir, { recursive: true, force: true });
+        }
+      });
+
+      it('does not share added representations between images', () => {
+        const imagePath = path.join(__dirname, 'fixtures', 'assets', 'logo.png');
+        const image = nativeImage.createFromPath(imagePath);
+        image.addRepresentation({ scaleFactor: 3.0, buffer: nativeImage.createFromPath(imagePath).toPNG() });
+        expect(image.getScaleFactors()).to.include(3.0);
+        expect(nativeImage.createFromPath(imagePath).getScaleFactors()).to.not.include(3.0);
+      });
+
+      it('does not share bitmap writes between images', () => {
+        const imagePath = path.join(__dirname, 'fixtures', 'assets', 'logo.png');
+        const image = nativeImage.createFromPath(imagePath);
+        const original = image.toBitmap();
+        image.getBitmap().fill(0);
+        expect(image.toBitmap().equals(original)).to.be.true();
+        expect(nativeImage.createFromPath(imagePath).toBitmap().equals(original)).to.be.true();
+      });
+
+      it('can be disabled', () => {
+        nativeImage.setCacheLimit(0);
+        expect(nativeImage.getCacheStats()).to.include({ count: 0, size: 0, limit: 0 });
+        const imagePath = path.join(__dirname, 'fixtures', 'assets', 'logo.png');
+        expect(nativeImage.createFromPath(imagePath).isEmpty()).to.be.false();
+        expect(nativeImage.getCacheStats()).to.include({ count: 0 });
+      });
+    });
+
     ifit(process.platform === 'darwin')('Gets an NSImage pointer on macOS', function () {
       const imagePath = `${path.join(__dirname, 'fixtures', 'api')}${path.sep}..${path.sep}${path.join('assets', 'logo.png')}`;
       const image = nativeImage.createFromPath(imagePath);
@@ -446,6 +502,46 @@ describe('nativeImage module', () => {
     });
   });
 
+  describe('async methods', () => {
+    const logoPath = path.join(__dirname, 'fixtures', 'assets', 'logo.png');
+
+    it('createFromPathAsync() decodes the same image as createFromPath()', async () => {
+      const image = await nativeImage.createFromPathAsync(logoPath);
+      expect(image.getSize()).to.deep.equal({ width: 538, height: 190 });
+      expect(image.toBitmap().equals(nativeImage.createFromPath(logoPath).toBitmap())).to.be.true();
+      expect((await nativeImage.createFromPathAsync('does-not-exist.png')).isEmpty()).to.be.true();
+    });
+
+    it('createFromBufferAsync() decodes the same image as createFromBuffer()', async () => {
+      const buffer = nativeImage.createFromPath(logoPath).toPNG();
+      const image = await nativeImage.createFromBufferAsync(buffer, { scaleFactor: 2.0 });
+      expect(image.getSize()).to.deep.equal({ width: 269, height: 95 });
+      await expect(nativeImage.createFromBufferAsync(12345)).to.eventually.be.rejectedWith('buffer must be a node Buffer');
+    });
+
+    it('encode the same data as the sync methods', async () => {
+      const image = nativeImage.createFromPath(logoPath);
+      expect((await image.toPNGAsync()).equals(image.toPNG())).to.be.true();
+      expect((await image.toPNGAsync({ scaleFactor: 2.0 })).equals(image.toPNG({ scaleFactor: 2.0 }))).to.be.true();
+      expect((await image.toJPEGAsync(80)).equals(image.toJPEG(80))).to.be.true();
+      expect(await image.toDataURLAsync()).to.equal(image.toDataURL());
+    });
+
+    it('resizeAsync() returns a resized image', async () => {
+      const image = nativeImage.createFromPath(logoPath);
+      expect((await image.resizeAsync({ width: 269 })).getSize()).to.deep.equal({ width: 269, height: 95 });
+      expect((await image.resizeAsync({ width: 0, height: 0 })).isEmpty()).to.be.true();
+    });
+
+    it('can run many requests at once', async () => {
+      const image = nativeImage.createFromPath(logoPath);
+      const thumbnails = await Promise.all(Array.from({ length: 20 }, () => image.resizeAsync({ width: 64 })));
+      for (const thumbnail of thumbnails) {
+        expect(thumbnail.getSize()).to.deep.equal({ width: 64, height: 23 });
+      }
+    });
+  });
+
   describe('crop(bounds)', () => {
     it('returns an empty image when called on an empty image', () => {
       expect(nativeImage.createEmpty().crop({ width: 1, height: 2, x: 0, y: 0 }).isEmpty()).to.be.true();
@@ -142,12 +142,15 @@ declare namespace NodeJS {
     hasUserActivation?: boolean;
     mode?: string;
     destination?: string;
+    priority?: 'throttled' | 'idle' | 'lowest' | 'low' | 'medium' | 'highest';
   };
   type ResponseHead = {
     statusCode: number;
     statusMessage: string;
     httpVersion: { major: number, minor: number };
     rawHeaders: { key: string, value: string }[];
+    connectionInfo: string;
+    socketReused: boolean;
   };
 
   type RedirectInfo = {